@@ -0,0 +1,48 @@
+#!/bin/bash
+#
+# Run a GRINS program at several thread counts and report the wall clock
+# time and speedup relative to the first thread count. Typical use is on
+# the reacting low Mach regression cases, e.g. from the build directory
+#
+#   contrib/scripts/thread_scaling.sh "1 2 4 8" test/reacting_low_mach_regression \
+#       test/input_files/reacting_low_mach_cantera_regression.in \
+#       ../test/test_data/reacting_low_mach_cantera_regression.xdr
+#
+# Thread counts are passed to libMesh with --n_threads. Any additional
+# arguments are forwarded to the program unchanged.
+
+if [ $# -lt 2 ]; then
+    echo "Usage: $0 \"thread counts\" program [program arguments]"
+    exit 1
+fi
+
+THREADS=$1
+shift
+PROG=$1
+shift
+
+base_time=""
+
+printf "%10s %14s %10s\n" "n_threads" "wall time [s]" "speedup"
+
+for n in $THREADS; do
+    start=$(date +%s.%N)
+    ${LIBMESH_RUN:-} $PROG "$@" --n_threads=$n > /dev/null 2>&1
+    status=$?
+    end=$(date +%s.%N)
+
+    if [ $status -ne 0 ]; then
+        echo "Error: $PROG failed with $n threads (exit status $status)"
+        exit $status
+    fi
+
+    elapsed=$(echo "$end - $start" | bc -l)
+
+    if [ -z "$base_time" ]; then
+        base_time=$elapsed
+    fi
+
+    speedup=$(echo "$base_time / $elapsed" | bc -l)
+
+    printf "%10d %14.3f %10.2f\n" $n $elapsed $speedup
+done
@@ -25,6 +25,9 @@
 #ifndef GRINS_BC_HANDLING_BASE_H
 #define GRINS_BC_HANDLING_BASE_H
 
+//C++
+#include <set>
+
 //libMesh
 #include "libmesh/libmesh.h"
 #include "libmesh/getpot.h"
@@ -87,6 +90,9 @@ namespace GRINS
 					 const GRINS::BoundaryID bc_id,
 					 const GRINS::BCType bc_type ) const;
 
+    //! Add the boundary ids on which apply_neumann_bcs() does any work
+    void neumann_bc_ids( std::set<GRINS::BoundaryID>& bc_ids ) const;
+
     virtual void init_dirichlet_bc_func_objs( libMesh::FEMSystem* system ) const;
 
     virtual void init_periodic_bcs( libMesh::FEMSystem* system ) const;
@@ -77,6 +77,9 @@ namespace GRINS
     /*! \todo Need to generalize this to multiple catalytic-walls-for-same-bcid case. */
     CatalyticWallBase<Chemistry>* get_catalytic_wall( const BoundaryID bc_id );
 
+    //! Add the boundary ids that have a catalytic wall
+    void catalytic_wall_ids( std::set<BoundaryID>& bc_ids ) const;
+
   protected:
 
     void build_catalycities( const GetPot& input,
@@ -26,11 +26,26 @@
 #ifndef GRINS_ASSEMBLY_CONTEXT_H
 #define GRINS_ASSEMBLY_CONTEXT_H
 
+// C++
+#include <map>
+
+// GRINS
+#include "grins/cached_values.h"
+
 // libMesh
 #include "libmesh/fem_context.h"
 
 namespace GRINS
 {
+  //! Base class for objects a Physics attaches to an AssemblyContext
+  /*! Such objects live as long as the context, i.e. they are per-thread
+      and are deleted when the context is destroyed. */
+  class AssemblyContextData
+  {
+  public:
+    virtual ~AssemblyContextData(){}
+  };
+
   class AssemblyContext : public libMesh::FEMContext
   {
   public:
@@ -38,10 +53,46 @@ namespace GRINS
     AssemblyContext( const libMesh::System& system );
     ~AssemblyContext();
 
+    //! Cache of quantities shared between Physics on the current element/side
+    /*! Each context is used by only one thread, so the cache storage
+        is allocated once and reused for every element this context visits. */
+    CachedValues& get_cache();
+
+    //! Retrieve the data owner attached to this context, or NULL if none
+    AssemblyContextData* get_physics_data( const void* owner ) const;
+
+    //! Attach data for owner to this context. The context takes ownership.
+    /*! This is const since attaching per-thread scratch data does not
+        change the state of the context as seen by assembly. Any data
+        previously attached for owner is deleted. */
+    void set_physics_data( const void* owner, AssemblyContextData* data ) const;
+
   protected:
 
+    CachedValues _cache;
+
+    mutable std::map<const void*,AssemblyContextData*> _physics_data;
+
   };
 
+  inline
+  CachedValues& AssemblyContext::get_cache()
+  {
+    return _cache;
+  }
+
+  inline
+  AssemblyContextData* AssemblyContext::get_physics_data( const void* owner ) const
+  {
+    std::map<const void*,AssemblyContextData*>::const_iterator it = _physics_data.find(owner);
+
+    AssemblyContextData* data = NULL;
+    if( it != _physics_data.end() )
+      data = it->second;
+
+    return data;
+  }
+
 } // end namespace GRINS
 
 #endif // GRINS_ASSEMBLY_CONTEXT_H
@@ -52,6 +52,12 @@ namespace GRINS
 
     ~BoussinesqBuoyancySPGSMStabilization();
 
+    //! Element Jacobians are not implemented for this physics
+    virtual bool has_analytic_jacobian() const;
+
+    //! Residuals depend on the velocity, pressure and temperature
+    virtual void residual_dependencies( std::set<VariableIndex>& vars ) const;
+
     virtual void element_time_derivative( bool compute_jacobian,
 					  AssemblyContext& context,
 					  CachedValues& cache );
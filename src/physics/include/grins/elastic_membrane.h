@@ -41,6 +41,12 @@ namespace GRINS
 
     virtual ~ElasticMembrane();
 
+    //! The compressible formulation has no element Jacobian for the lambda_sq constraint
+    virtual bool has_analytic_jacobian() const;
+
+    //! Residuals depend on the displacements and, if compressible, lambda_sq
+    virtual void residual_dependencies( std::set<VariableIndex>& vars ) const;
+
     virtual void init_variables( libMesh::FEMSystem* system );
 
     //! Register postprocessing variables for ElasticMembrane
@@ -0,0 +1,198 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+
+#ifndef GRINS_ELEMENT_KERNELS_H
+#define GRINS_ELEMENT_KERNELS_H
+
+// C++
+#include <vector>
+
+// GRINS
+#include "grins/assembly_context.h"
+
+// libMesh
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_submatrix.h"
+#include "libmesh/vector_value.h"
+
+namespace GRINS
+{
+  //! Shape function values and gradients in contiguous storage
+  /*!
+    libMesh stores phi[i][qp] as a vector of vectors. Here phi and each
+    component of dphi are packed into a single n_dofs x n_qpoints row-major
+    array, so the quadrature sums that make up an element matrix become dot
+    products over contiguous memory. Storage is kept between elements.
+   */
+  class PackedShapeFunctions
+  {
+  public:
+
+    PackedShapeFunctions();
+    ~PackedShapeFunctions();
+
+    //! Pack shape function values, phi[i][qp]
+    void pack_phi( const std::vector<std::vector<libMesh::Real> >& phi );
+
+    //! Pack the first dim components of the shape function gradients, dphi[i][qp]
+    void pack_dphi( const std::vector<std::vector<libMesh::RealGradient> >& dphi,
+                    unsigned int dim );
+
+    unsigned int n_dofs() const;
+
+    unsigned int n_qpoints() const;
+
+    unsigned int dim() const;
+
+    //! Packed phi, n_dofs x n_qpoints
+    const libMesh::Real* phi() const;
+
+    //! Packed component d of dphi, n_dofs x n_qpoints
+    const libMesh::Real* dphi( unsigned int d ) const;
+
+    //! Compute out(j,qp) = U[qp]*dphi[j][qp], e.g. for linearized convection terms
+    void advective_derivative( const std::vector<libMesh::Gradient>& U,
+                               std::vector<libMesh::Real>& out ) const;
+
+  protected:
+
+    unsigned int _n_dofs;
+    unsigned int _n_qpoints;
+    unsigned int _dim;
+
+    std::vector<libMesh::Real> _phi;
+
+    //! _dim consecutive n_dofs x n_qpoints blocks
+    std::vector<libMesh::Real> _dphi;
+
+  };
+
+  //! Per-context storage and dense kernels for element matrix assembly
+  /*!
+    Element Jacobian blocks of the form
+    \f$ K_{ij} = \sum_{qp} A_{i,qp} w_{qp} B_{j,qp} \f$
+    (mass, convection, diffusion and coupling terms) are computed here as
+    small dense matrix-matrix products over packed shape functions, rather
+    than scalar by scalar inside the (i,j,qp) loops. A Physics fills the
+    packed shape functions and per-qp weights during its quadrature loop,
+    then forms each distinct block once and adds it wherever it is needed.
+    When libMesh was built with Eigen the products are done by Eigen,
+    otherwise by plain loops.
+
+    The workspace is attached to the AssemblyContext, so it is per-thread
+    and its storage is reused from element to element.
+   */
+  class ElementKernelWorkspace : public AssemblyContextData
+  {
+  public:
+
+    ElementKernelWorkspace();
+    virtual ~ElementKernelWorkspace();
+
+    //! Workspace attached to context for owner, built on first use
+    static ElementKernelWorkspace& get( const AssemblyContext& context, const void* owner );
+
+    //! Size n_weights per-qp weight arrays to n_qpoints and zero them
+    void init_weights( unsigned int n_weights, unsigned int n_qpoints );
+
+    //! M += A diag(w) B^T, with A n_i x n_qp and B n_j x n_qp. M must be n_i x n_j.
+    void add_weighted_product( const libMesh::Real* A, unsigned int n_i,
+                               const std::vector<libMesh::Real>& w,
+                               const libMesh::Real* B, unsigned int n_j,
+                               libMesh::DenseMatrix<libMesh::Real>& M );
+
+    //! M(i,j) += sum_qp w(qp) dphi_A(i,qp).dphi_B(j,qp)
+    void add_weighted_gradient_product( const PackedShapeFunctions& A,
+                                        const std::vector<libMesh::Real>& w,
+                                        const PackedShapeFunctions& B,
+                                        libMesh::DenseMatrix<libMesh::Real>& M );
+
+    //! Add the dense block M into the element Jacobian block K
+    static void add_block( const libMesh::DenseMatrix<libMesh::Real>& M,
+                           libMesh::DenseSubMatrix<libMesh::Number>& K );
+
+    //! Shape functions of the variable being tested
+    PackedShapeFunctions shape;
+
+    //! Shape functions of a coupled variable, e.g. pressure or velocity
+    PackedShapeFunctions coupled_shape;
+
+    //! Per-qp weights, including JxW
+    std::vector<std::vector<libMesh::Real> > weights;
+
+    //! Per-qp velocity, e.g. for advective_derivative()
+    std::vector<libMesh::Gradient> velocity;
+
+    //! Per-qp, per-dof auxiliary array, e.g. from advective_derivative()
+    std::vector<libMesh::Real> advective;
+
+    //! Dense blocks to be formed and added to the element Jacobian
+    std::vector<libMesh::DenseMatrix<libMesh::Real> > blocks;
+
+  protected:
+
+    //! A scaled by w, reused between products
+    std::vector<libMesh::Real> _scaled;
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+
+  inline
+  unsigned int PackedShapeFunctions::n_dofs() const
+  {
+    return _n_dofs;
+  }
+
+  inline
+  unsigned int PackedShapeFunctions::n_qpoints() const
+  {
+    return _n_qpoints;
+  }
+
+  inline
+  unsigned int PackedShapeFunctions::dim() const
+  {
+    return _dim;
+  }
+
+  inline
+  const libMesh::Real* PackedShapeFunctions::phi() const
+  {
+    libmesh_assert( !_phi.empty() );
+    return &_phi[0];
+  }
+
+  inline
+  const libMesh::Real* PackedShapeFunctions::dphi( unsigned int d ) const
+  {
+    libmesh_assert_less( d, _dim );
+    return &_dphi[d*_n_dofs*_n_qpoints];
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_ELEMENT_KERNELS_H
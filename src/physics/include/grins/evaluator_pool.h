@@ -0,0 +1,187 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef GRINS_EVALUATOR_POOL_H
+#define GRINS_EVALUATOR_POOL_H
+
+// C++
+#include <vector>
+
+// GRINS
+#include "grins/assembly_context.h"
+
+// libMesh
+#include "libmesh/threads.h"
+
+namespace GRINS
+{
+  //! Thread-safe pool of property evaluators built from a single mixture
+  /*!
+    Evaluators (e.g. AntiochEvaluator) heap allocate their thermo, kinetics
+    and cache objects on construction. Rather than building one per element,
+    each AssemblyContext acquires an Evaluator from this pool the first time
+    it is needed and returns it when the context is destroyed. Evaluators are
+    only built when no free one is available, so the total number built is
+    bounded by the number of simultaneously live contexts (i.e. threads) and
+    they are reused for the whole solve. The mutex is only taken on
+    acquire/release, never per element.
+   */
+  template<typename Evaluator, typename Mixture>
+  class EvaluatorPool
+  {
+  public:
+
+    EvaluatorPool( Mixture& mixture );
+    ~EvaluatorPool();
+
+    //! Take an evaluator from the pool, building a new one if none are free
+    Evaluator* acquire();
+
+    //! Give an evaluator previously obtained from acquire() back to the pool
+    void release( Evaluator* evaluator );
+
+    //! Total number of evaluators built by this pool
+    unsigned int n_built() const;
+
+  protected:
+
+    Mixture& _mixture;
+
+    //! All evaluators built by this pool. These are deleted in the destructor.
+    std::vector<Evaluator*> _all_evaluators;
+
+    //! Evaluators available for reuse
+    std::vector<Evaluator*> _free_evaluators;
+
+    //! Mutable so that n_built() can lock it too
+    mutable libMesh::Threads::spin_mutex _mutex;
+
+  private:
+
+    EvaluatorPool();
+
+  };
+
+  //! Holds an Evaluator from an EvaluatorPool for the lifetime of an AssemblyContext
+  template<typename Evaluator, typename Mixture>
+  class PooledEvaluator : public AssemblyContextData
+  {
+  public:
+
+    PooledEvaluator( EvaluatorPool<Evaluator,Mixture>& pool )
+      : _pool(pool),
+        _evaluator(pool.acquire())
+    {}
+
+    virtual ~PooledEvaluator()
+    { _pool.release(_evaluator); }
+
+    Evaluator& evaluator()
+    { return *_evaluator; }
+
+  protected:
+
+    EvaluatorPool<Evaluator,Mixture>& _pool;
+
+    Evaluator* _evaluator;
+
+  private:
+
+    PooledEvaluator();
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+
+  template<typename Evaluator, typename Mixture>
+  inline
+  EvaluatorPool<Evaluator,Mixture>::EvaluatorPool( Mixture& mixture )
+    : _mixture(mixture)
+  {
+    return;
+  }
+
+  template<typename Evaluator, typename Mixture>
+  inline
+  EvaluatorPool<Evaluator,Mixture>::~EvaluatorPool()
+  {
+    for( typename std::vector<Evaluator*>::iterator it = _all_evaluators.begin();
+         it != _all_evaluators.end(); ++it )
+      {
+        delete *it;
+      }
+
+    return;
+  }
+
+  template<typename Evaluator, typename Mixture>
+  inline
+  Evaluator* EvaluatorPool<Evaluator,Mixture>::acquire()
+  {
+    {
+      libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+
+      if( !_free_evaluators.empty() )
+        {
+          Evaluator* evaluator = _free_evaluators.back();
+          _free_evaluators.pop_back();
+          return evaluator;
+        }
+    }
+
+    // Build outside the lock; construction is the expensive part.
+    Evaluator* evaluator = new Evaluator(_mixture);
+
+    {
+      libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+      _all_evaluators.push_back(evaluator);
+    }
+
+    return evaluator;
+  }
+
+  template<typename Evaluator, typename Mixture>
+  inline
+  void EvaluatorPool<Evaluator,Mixture>::release( Evaluator* evaluator )
+  {
+    libmesh_assert(evaluator);
+
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+    _free_evaluators.push_back(evaluator);
+
+    return;
+  }
+
+  template<typename Evaluator, typename Mixture>
+  inline
+  unsigned int EvaluatorPool<Evaluator,Mixture>::n_built() const
+  {
+    // acquire() may be growing _all_evaluators on another thread
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+    return _all_evaluators.size();
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_EVALUATOR_POOL_H
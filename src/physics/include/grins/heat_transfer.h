@@ -52,6 +52,9 @@ namespace GRINS
     virtual void register_postprocessing_vars( const GetPot& input,
                                                PostProcessedQuantities<libMesh::Real>& postprocessing );
 
+    //! Selects the element kernel for the mesh dimension and axisymmetry
+    virtual void auxiliary_init( MultiphysicsSystem& system );
+
     // residual and jacobian calculations
     // element_*, side_* as *time_derivative, *constraint, *mass_residual
 
@@ -82,6 +85,16 @@ namespace GRINS
     //! Index from registering this postprocessed quantity
     unsigned int _k_index;
 
+    //! Interior residual and Jacobian, specialized on dimension and axisymmetry
+    template<unsigned int Dim, bool is_axisymmetric>
+    void element_time_derivative_kernel( bool compute_jacobian,
+                                         AssemblyContext& context );
+
+    typedef void (HeatTransfer<Conductivity>::*ElementKernel)( bool, AssemblyContext& );
+
+    //! Kernel used by element_time_derivative(), chosen in auxiliary_init()
+    ElementKernel _element_time_derivative_kernel;
+
   };
 
 } // end namespace block
@@ -41,6 +41,12 @@ namespace GRINS
     HeatTransferSPGSMStabilization( const GRINS::PhysicsName& physics_name, const GetPot& input );
     virtual ~HeatTransferSPGSMStabilization();
 
+    //! Element Jacobians are not implemented for this physics
+    virtual bool has_analytic_jacobian() const;
+
+    //! Residuals depend on the velocity and temperature
+    virtual void residual_dependencies( std::set<VariableIndex>& vars ) const;
+
     virtual void element_time_derivative( bool compute_jacobian,
                                           AssemblyContext& context,
                                           CachedValues& cache );
@@ -56,6 +56,9 @@ namespace GRINS
     virtual void register_postprocessing_vars( const GetPot& input,
                                                PostProcessedQuantities<libMesh::Real>& postprocessing );
 
+    //! Selects the element kernel for the mesh dimension and axisymmetry
+    virtual void auxiliary_init( MultiphysicsSystem& system );
+
     // residual and jacobian calculations
     // element_*, side_* as *time_derivative, *constraint, *mass_residual
 
@@ -73,6 +76,9 @@ namespace GRINS
                                   AssemblyContext& context,
                                   CachedValues& cache );
 
+    //! Pressure pinning is done on every side
+    virtual bool side_work_boundary_ids( std::set<BoundaryID>& bc_ids ) const;
+
     // Mass matrix part(s)
     virtual void mass_residual( bool compute_jacobian,
 				AssemblyContext& context,
@@ -94,6 +100,18 @@ namespace GRINS
     //! Index from registering this quantity
     unsigned int _mu_index;
 
+    //! Interior residual and Jacobian, specialized on dimension and axisymmetry
+    /*! Dimension and axisymmetry are compile time constants here, so their
+        branches and the unused velocity components drop out of the DoF loops. */
+    template<unsigned int Dim, bool is_axisymmetric>
+    void element_time_derivative_kernel( bool compute_jacobian,
+                                         AssemblyContext& context );
+
+    typedef void (IncompressibleNavierStokes<Viscosity>::*ElementKernel)( bool, AssemblyContext& );
+
+    //! Kernel used by element_time_derivative(), chosen in auxiliary_init()
+    ElementKernel _element_time_derivative_kernel;
+
   private:
     IncompressibleNavierStokes();
 
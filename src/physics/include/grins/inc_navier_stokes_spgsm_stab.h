@@ -40,6 +40,12 @@ namespace GRINS
     IncompressibleNavierStokesSPGSMStabilization( const GRINS::PhysicsName& physics_name, const GetPot& input );
     virtual ~IncompressibleNavierStokesSPGSMStabilization();
 
+    //! Element Jacobians are not implemented for this physics
+    virtual bool has_analytic_jacobian() const;
+
+    //! Residuals depend on the velocity and pressure
+    virtual void residual_dependencies( std::set<VariableIndex>& vars ) const;
+
     virtual void element_time_derivative( bool compute_jacobian,
 					  AssemblyContext& context,
 					  CachedValues& cache );
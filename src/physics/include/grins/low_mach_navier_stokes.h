@@ -56,6 +56,9 @@ namespace GRINS
     // Context initialization
     virtual void init_context( AssemblyContext& context );
 
+    //! Selects the element kernel for the mesh dimension
+    virtual void auxiliary_init( MultiphysicsSystem& system );
+
     // Time dependent part(s)
     virtual void element_time_derivative( bool compute_jacobian,
 					  AssemblyContext& context,
@@ -69,6 +72,9 @@ namespace GRINS
                                   AssemblyContext& context,
                                   CachedValues& cache );
 
+    //! Pressure pinning and the thermodynamic pressure are done on every side
+    virtual bool side_work_boundary_ids( std::set<BoundaryID>& bc_ids ) const;
+
     // Mass matrix part(s)
     virtual void mass_residual( bool compute_jacobian,
 				AssemblyContext& context,
@@ -92,17 +98,34 @@ namespace GRINS
     //! Cache index for density post-processing
     unsigned int _rho_index;
 
+    //! Interior continuity, momentum, and energy terms for a Dim dimensional mesh
+    /*! The dimension is a compile time constant in this and the helpers below,
+        so the unused velocity components drop out of the DoF loops. */
+    template<unsigned int Dim>
+    void element_time_derivative_kernel( bool compute_jacobian,
+                                         AssemblyContext& context,
+                                         CachedValues& cache );
+
+    typedef void (LowMachNavierStokes<Viscosity,SpecificHeat,ThermalConductivity>::*ElementKernel)
+      ( bool, AssemblyContext&, CachedValues& );
+
+    //! Kernel used by element_time_derivative(), chosen in auxiliary_init()
+    ElementKernel _element_time_derivative_kernel;
+
     //! Helper function
+    template<unsigned int Dim>
     void assemble_mass_time_deriv( bool compute_jacobian, 
 				   AssemblyContext& context,
 				   CachedValues& cache );
 
     //! Helper function
+    template<unsigned int Dim>
     void assemble_momentum_time_deriv( bool compute_jacobian, 
 				       AssemblyContext& context,
 				       CachedValues& cache );
 
     //! Helper function
+    template<unsigned int Dim>
     void assemble_energy_time_deriv( bool compute_jacobian, 
 				     AssemblyContext& context,
 				     CachedValues& cache );
@@ -51,22 +51,28 @@ namespace GRINS
   protected:
 
     void assemble_continuity_time_deriv( bool compute_jacobian,
-					 AssemblyContext& context );
+					 AssemblyContext& context,
+					 const LowMachNavierStokesStabilizationWorkspace& ws );
 
     void assemble_momentum_time_deriv( bool compute_jacobian,
-				       AssemblyContext& context );
+				       AssemblyContext& context,
+				       const LowMachNavierStokesStabilizationWorkspace& ws );
 
     void assemble_energy_time_deriv( bool compute_jacobian,
-				     AssemblyContext& context );
+				     AssemblyContext& context,
+				     const LowMachNavierStokesStabilizationWorkspace& ws );
 
     void assemble_continuity_mass_residual( bool compute_jacobian,
-					    AssemblyContext& context );
+					    AssemblyContext& context,
+					    const LowMachNavierStokesStabilizationWorkspace& ws );
 
     void assemble_momentum_mass_residual( bool compute_jacobian,
-					  AssemblyContext& context );
+					  AssemblyContext& context,
+					  const LowMachNavierStokesStabilizationWorkspace& ws );
 
     void assemble_energy_mass_residual( bool compute_jacobian,
-					AssemblyContext& context );
+					AssemblyContext& context,
+					const LowMachNavierStokesStabilizationWorkspace& ws );
     
   private:
 
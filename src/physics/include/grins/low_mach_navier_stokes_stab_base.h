@@ -28,6 +28,7 @@
 //GRINS
 #include "grins/low_mach_navier_stokes_base.h"
 #include "grins/low_mach_navier_stokes_stab_helper.h"
+#include "grins/low_mach_navier_stokes_stab_workspace.h"
 
 //! GRINS namespace
 namespace GRINS
@@ -66,6 +67,24 @@ namespace GRINS
 
   protected:
 
+    //! Workspace attached to context for this physics, built on first use
+    LowMachNavierStokesStabilizationWorkspace& stab_workspace( const AssemblyContext& context ) const;
+
+    //! Evaluate the stabilization quantities needed by element_time_derivative
+    /*! State is taken from the current solution, tau includes the time
+        scale unless the problem is steady, and the steady residuals are
+        computed. */
+    void compute_time_deriv_workspace( AssemblyContext& context,
+                                       LowMachNavierStokesStabilizationWorkspace& ws ) const;
+
+    //! Evaluate the stabilization quantities needed by mass_residual
+    /*! State is taken from the fixed solution, tau omits the time scale,
+        and the transient residuals are computed. The steady residuals are
+        only computed if compute_steady_residuals is true. */
+    void compute_mass_residual_workspace( AssemblyContext& context,
+                                          bool compute_steady_residuals,
+                                          LowMachNavierStokesStabilizationWorkspace& ws ) const;
+
     LowMachNavierStokesStabilizationHelper _stab_helper;
     
   private:
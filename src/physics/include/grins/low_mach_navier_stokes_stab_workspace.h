@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+
+#ifndef GRINS_LOW_MACH_NAVIER_STOKES_STAB_WORKSPACE_H
+#define GRINS_LOW_MACH_NAVIER_STOKES_STAB_WORKSPACE_H
+
+// C++
+#include <vector>
+
+// GRINS
+#include "grins/assembly_context.h"
+
+// libMesh
+#include "libmesh/vector_value.h"
+#include "libmesh/tensor_value.h"
+
+namespace GRINS
+{
+  //! Per-quadrature-point quantities shared by the stabilized low Mach assemblies
+  /*!
+    The continuity, momentum and energy stabilization terms all need the
+    metric g and G, the state, the stabilization parameters and the strong
+    residuals at every quadrature point. The stabilized LowMachNavierStokes
+    classes evaluate these once per element into this workspace and each
+    assembly routine reads from it. The workspace is attached to the
+    AssemblyContext, so it is per-thread and its storage is reused across
+    elements.
+   */
+  class LowMachNavierStokesStabilizationWorkspace : public AssemblyContextData
+  {
+  public:
+
+    LowMachNavierStokesStabilizationWorkspace();
+    virtual ~LowMachNavierStokesStabilizationWorkspace();
+
+    //! Size all per-qp storage for n_qpoints. Capacity is kept between elements.
+    void resize( unsigned int n_qpoints );
+
+    unsigned int n_qpoints;
+
+    std::vector<libMesh::RealGradient> g;
+    std::vector<libMesh::RealTensor> G;
+
+    std::vector<libMesh::Real> T;
+    std::vector<libMesh::Real> rho;
+    std::vector<libMesh::Real> mu;
+    std::vector<libMesh::Real> k;
+    std::vector<libMesh::Real> cp;
+    std::vector<libMesh::RealGradient> U;
+
+    std::vector<libMesh::Real> tau_M;
+    std::vector<libMesh::Real> tau_C;
+    std::vector<libMesh::Real> tau_E;
+
+    //! Steady residuals. Filled by the time derivative workspace and, on request, the mass workspace.
+    std::vector<libMesh::Real> RC_s;
+    std::vector<libMesh::RealGradient> RM_s;
+    std::vector<libMesh::Real> RE_s;
+
+    //! Transient residuals. Only filled by the mass residual workspace.
+    std::vector<libMesh::Real> RC_t;
+    std::vector<libMesh::RealGradient> RM_t;
+    std::vector<libMesh::Real> RE_t;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_LOW_MACH_NAVIER_STOKES_STAB_WORKSPACE_H
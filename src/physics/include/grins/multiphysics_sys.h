@@ -27,7 +27,9 @@
 #define GRINS_MULTIPHYSICS_SYS_H
 
 // C++
+#include <set>
 #include <string>
+#include <vector>
 
 // GRINS
 #include "grins_config.h"
@@ -120,6 +122,9 @@ namespace GRINS
     //! Context initialization. Calls each physics implementation of init_context()
     virtual void init_context( libMesh::DiffContext &context );
 
+    //! Calls each physics implementation of pre_solve(), FEMSystem::solve(), then each post_solve()
+    virtual void solve();
+
     // residual and jacobian calculations
     // element_*, side_* as *time_derivative, *constraint, *mass_residual
 
@@ -168,6 +173,29 @@ namespace GRINS
                                                  const libMesh::Point& point,
                                                  libMesh::Real& value );
 
+    //! Print run statistics of each physics, see Physics::print_statistics
+    /*! Must be called on all processors. */
+    void print_physics_statistics( std::ostream& out ) const;
+
+    //! Whether linear-nonlinear-solver/jacobian_free was requested
+    bool jacobian_free() const;
+
+    //! Whether a preconditioning matrix is assembled in jacobian_free mode
+    bool assemble_preconditioner() const;
+
+    //! Restrict Jacobian assembly to the preconditioner Physics
+    /*! While set, Physics not listed in linear-nonlinear-solver/preconditioner_physics
+        are skipped entirely, so assembly(false,true) builds the cheaper
+        operator used to precondition the Jacobian-free Newton-Krylov solve.
+        If no Physics were listed, all of them are assembled. */
+    void set_preconditioner_assembly( bool assembling_preconditioner );
+
+    //! Sets whether the Physics stabilize for a steady problem, see Physics::set_is_steady
+    /*! init_data() sets this from the time solver. Solvers that march a
+        steady problem in pseudo-time reset it afterwards so that the
+        stabilization does not depend on the pseudo-timestep. */
+    void set_is_steady( bool is_steady );
+
 #ifdef GRINS_USE_GRVY_TIMERS
     //! Add GRVY Timer object to system for timing physics.
     void attach_grvy_timer( GRVY::GRVY_Timer_Class* grvy_timer );
@@ -181,6 +209,103 @@ namespace GRINS
     PhysicsList _physics_list;
 
     bool _use_numerical_jacobians_only;
+
+    //! Finite difference element Jacobians of Physics without analytic ones
+    /*! When set, Physics reporting has_analytic_jacobian() == false are
+        differentiated here, perturbing only the degrees of freedom of their
+        residual_dependencies(), while every other Physics assembles its
+        analytic Jacobian. This replaces the libMesh numerical Jacobian, which
+        differentiates all Physics with respect to all element dofs. */
+    bool _use_fd_jacobians;
+
+    //! Perturb the union of the dependencies once for all such Physics
+    /*! Instead of one perturbation sweep per Physics, all Physics without
+        analytic Jacobians are evaluated together for each perturbed state. */
+    bool _batch_fd_jacobians;
+
+    //! Physics without analytic Jacobians, filled in init_data()
+    std::vector<Physics*> _fd_physics;
+
+    //! Variables perturbed for each entry of _fd_physics
+    std::vector<std::vector<VariableIndex> > _fd_vars;
+
+    //! Union of _fd_vars, used for batched perturbation
+    std::vector<VariableIndex> _fd_all_vars;
+
+    //! Apply the Jacobian by differencing residuals instead of assembling it
+    bool _jacobian_free;
+
+    //! Assemble a preconditioning matrix when _jacobian_free is set
+    bool _assemble_preconditioner;
+
+    //! Physics names read from linear-nonlinear-solver/preconditioner_physics
+    std::vector<std::string> _preconditioner_physics_names;
+
+    //! Physics assembled into the preconditioner, filled in init_data()
+    std::set<const Physics*> _preconditioner_physics;
+
+    //! Set while the preconditioning matrix is being assembled
+    bool _assembling_preconditioner;
+
+    //! Whether physics contributes to the current assembly
+    bool _assembles( const Physics& physics ) const;
+
+    //! Check and collect the Physics named for preconditioner assembly
+    void _init_preconditioner_physics();
+
+    //! Physics evaluated on one subdomain, in _physics_list order
+    struct PhysicsDispatch
+    {
+      //! Physics whose cache functions are evaluated
+      std::vector<Physics*> cache;
+
+      //! Physics enabled on the subdomain
+      std::vector<Physics*> residual;
+
+      //! Enabled Physics with analytic Jacobians
+      std::vector<Physics*> analytic;
+
+      //! Indices into _fd_physics of the enabled Physics
+      std::vector<unsigned int> fd;
+    };
+
+    //! Dispatch tables indexed by subdomain id, filled in init_data()
+    std::vector<PhysicsDispatch> _subdomain_dispatch;
+
+    //! Dispatch for subdomain ids past the end of _subdomain_dispatch
+    /*! No Physics names such subdomains, so only unrestricted Physics run there. */
+    PhysicsDispatch _unrestricted_dispatch;
+
+    //! Dispatch for evaluations without an element: every Physics
+    PhysicsDispatch _nonlocal_dispatch;
+
+    //! Build the dispatch tables from the Physics enabled_subdomains()
+    /*! Must be called after _init_fd_jacobians(). */
+    void _init_dispatch_tables();
+
+    //! Fill dispatch with the Physics enabled on subdomain and their cache producers
+    /*! With elem_free set, every Physics is enabled. */
+    void _build_dispatch( libMesh::subdomain_id_type subdomain,
+                          bool elem_free,
+                          PhysicsDispatch& dispatch ) const;
+
+    //! Dispatch table for the element (or lack thereof) of context
+    const PhysicsDispatch& _dispatch( const AssemblyContext& context ) const;
+
+    //! Whether some Physics does side work on each boundary id, indexed by id
+    /*! Filled in init_data() from Physics::side_work_boundary_ids(). Ids
+        past the end have no side work. */
+    std::vector<bool> _boundary_side_work;
+
+    //! Some Physics does side work that does not depend on the boundary id
+    bool _side_work_everywhere;
+
+    //! Collect the boundary ids with side work from every Physics
+    void _init_side_work();
+
+    //! Whether any Physics does work on the current side of context
+    /*! Sides without work skip _general_residual, and with it the side caches. */
+    bool _has_side_work( const AssemblyContext& context ) const;
     
 #ifdef GRINS_USE_GRVY_TIMERS
     GRVY::GRVY_Timer_Class* _timer;
@@ -195,8 +320,75 @@ namespace GRINS
 			    libMesh::DiffContext& context,
                             ResFuncType resfunc,
                             CacheFuncType cachefunc);
+
+    //! Collect the Physics (and their variables) needing finite differenced Jacobians
+    void _init_fd_jacobians();
+
+    //! Add finite difference Jacobians of the _fd_physics enabled on this element
+    /*! These Physics are skipped by _general_residual when _use_fd_jacobians
+        is set; their residual contribution is added here. */
+    void _fd_jacobian( const PhysicsDispatch& dispatch,
+                       AssemblyContext& context,
+                       CachedValues& cache,
+                       ResFuncType resfunc,
+                       CacheFuncType cachefunc );
+
+    //! Evaluate a group of Physics at perturbed states of their variables
+    /*! Adds the unperturbed residual of the group to fd_residual and the
+        forward differences into the element Jacobian. Every Physics in
+        cache_physics recomputes its cache at each perturbed state, since
+        the group may read quantities cached by Physics outside it. */
+    void _fd_jacobian_group( const std::vector<Physics*>& physics,
+                             const std::vector<VariableIndex>& vars,
+                             const std::vector<Physics*>& cache_physics,
+                             AssemblyContext& context,
+                             CachedValues& cache,
+                             ResFuncType resfunc,
+                             CacheFuncType cachefunc,
+                             libMesh::DenseVector<libMesh::Number>& fd_residual );
+
+    //! Clear the cache and evaluate cachefunc of each of cache_physics
+    void _compute_cache( const std::vector<Physics*>& cache_physics,
+                         AssemblyContext& context,
+                         CachedValues& cache,
+                         CacheFuncType cachefunc );
   };
 
+  inline
+  bool MultiphysicsSystem::jacobian_free() const
+  {
+    return _jacobian_free;
+  }
+
+  inline
+  bool MultiphysicsSystem::assemble_preconditioner() const
+  {
+    return _assemble_preconditioner;
+  }
+
+  inline
+  void MultiphysicsSystem::set_preconditioner_assembly( bool assembling_preconditioner )
+  {
+    _assembling_preconditioner = assembling_preconditioner;
+  }
+
+  inline
+  void MultiphysicsSystem::set_is_steady( bool is_steady )
+  {
+    libmesh_assert( !_physics_list.empty() );
+
+    // Since the variable is static, just call one Physics class
+    (_physics_list.begin()->second)->set_is_steady( is_steady );
+  }
+
+  inline
+  bool MultiphysicsSystem::_assembles( const Physics& physics ) const
+  {
+    return !_assembling_preconditioner ||
+      _preconditioner_physics.empty() ||
+      _preconditioner_physics.count( &physics );
+  }
+
   inline
   std::tr1::shared_ptr<GRINS::Physics> MultiphysicsSystem::get_physics( const std::string physics_name ) const
   {
@@ -27,9 +27,7 @@
 
 // GRINS
 #include "grins/source_term_base.h"
-
-// libMesh
-#include "libmesh/parsed_function.h"
+#include "grins/compiled_function.h"
 
 namespace GRINS
 {
@@ -48,7 +46,7 @@ namespace GRINS
 
   protected:
 
-    libMesh::ParsedFunction<libMesh::Real> _value;
+    CompiledFunction _value;
 
   private:
 
@@ -26,6 +26,7 @@
 #define GRINS_PHYSICS_H
 
 // C++
+#include <iostream>
 #include <string>
 #include <set>
 
@@ -58,6 +59,11 @@ namespace libMesh
 
   template <typename Scalar>
   class ParameterMultiPointer;
+
+  namespace Parallel
+  {
+    class Communicator;
+  }
 }
 
 //! GRINS namespace
@@ -120,6 +126,23 @@ namespace GRINS
     //! Find if current physics is active on supplied element
     virtual bool enabled_on_elem( const libMesh::Elem* elem );
 
+    //! Subdomains on which this physics is enabled. Empty means all subdomains.
+    /*! MultiphysicsSystem builds its per-subdomain dispatch tables from this
+      set, so element assembly does not call enabled_on_elem(). */
+    const std::set<libMesh::subdomain_id_type>& enabled_subdomains() const;
+
+    //! Other Physics whose cached values the residuals of this physics read
+    /*! MultiphysicsSystem only computes the cache of the Physics enabled on
+      an element and of the producers they name here. Default is none. */
+    virtual void cache_producers( std::set<PhysicsName>& producers ) const;
+
+    //! Add the boundary ids on which the side residuals of this physics do work
+    /*! MultiphysicsSystem skips sides on which no Physics does work.
+      Returns false if the side work does not depend on the boundary id,
+      e.g. pressure pinning, so that every side is visited. The default
+      adds the Neumann boundary ids of the BC handler. */
+    virtual bool side_work_boundary_ids( std::set<BoundaryID>& bc_ids ) const;
+
     //! Sets whether this physics is to be solved with a steady solver or not
     /*! Since the member variable is static, only needs to be called on a single
       physics. */
@@ -142,6 +165,16 @@ namespace GRINS
         safely query the MultiphysicsSystem about variable information. */
     virtual void auxiliary_init( MultiphysicsSystem& system );
 
+    //! Called by MultiphysicsSystem::solve() before each solve
+    /*! The mesh may have been refined or redistributed since the previous
+        solve, so this is the place to rebuild data tabulated on the mesh.
+        Default is to do nothing. */
+    virtual void pre_solve( MultiphysicsSystem& system );
+
+    //! Called by MultiphysicsSystem::solve() after each solve
+    /*! Default is to do nothing. */
+    virtual void post_solve( MultiphysicsSystem& system );
+
     //! Register name of postprocessed quantity with PostProcessedQuantities
     /*!
       Each Physics class will need to cache an unsigned int corresponding to each
@@ -154,6 +187,18 @@ namespace GRINS
     //! Initialize context for added physics variables
     virtual void init_context( AssemblyContext& context );
 
+    //! Whether this physics assembles its own element Jacobians
+    /*! Physics returning false are differentiated by finite differences
+      in MultiphysicsSystem when linear-nonlinear-solver/use_grins_fd_jacobians
+      is set. Default is true. */
+    virtual bool has_analytic_jacobian() const;
+
+    //! Variables the residuals of this physics depend on
+    /*! Only used by the finite-difference Jacobian in MultiphysicsSystem:
+      only the degrees of freedom of these variables are perturbed. Leaving
+      the set empty, the default, means every system variable is perturbed. */
+    virtual void residual_dependencies( std::set<VariableIndex>& vars ) const;
+
     // residual and jacobian calculations
     // element_*, side_* as *time_derivative, *constraint, *mass_residual
 
@@ -235,6 +280,12 @@ namespace GRINS
                                                  const libMesh::Point& point,
                                                  libMesh::Real& value );
 
+    //! Print run statistics, e.g. of property caches, at the end of a solve
+    /*! Called on every processor, so that statistics can be summed over comm,
+        but only rank 0 should print. Default does nothing. */
+    virtual void print_statistics( const libMesh::Parallel::Communicator& comm,
+                                   std::ostream& out ) const;
+
     BCHandlingBase* get_bc_handler(); 
 
     ICHandlingBase* get_ic_handler(); 
@@ -267,6 +318,11 @@ namespace GRINS
 
     bool _is_axisymmetric;
 
+    //! Assemble Jacobians by forward-mode automatic differentiation
+    /*! Set by Physics/use_ad_jacobians. Only honored by Physics whose residual
+      kernels are templated on the scalar type (see DualNumber); others ignore it. */
+    bool _use_ad_jacobians;
+
 #ifdef GRINS_USE_GRVY_TIMERS
     GRVY::GRVY_Timer_Class* _timer;
 #endif
@@ -290,6 +346,12 @@ namespace GRINS
     return _ic_handler;
   }
 
+  inline
+  const std::set<libMesh::subdomain_id_type>& Physics::enabled_subdomains() const
+  {
+    return _enabled_subdomains;
+  }
+
 } // End namespace GRINS
 
 #endif //GRINS_PHYSICS_H
@@ -49,6 +49,23 @@ namespace GRINS
     // Context initialization
     virtual void init_context( AssemblyContext& context );
 
+    //! Only constant viscosity transport has a complete analytic Jacobian
+    /*! The element Jacobian differentiates constant conductivity or constant
+        Prandtl number conductivity, with constant Lewis number diffusivities.
+        Wilke mixing (Sutherland or Blottner viscosity, Eucken conductivity)
+        and Cantera transport are not differentiated, so those mixtures are
+        left to the finite difference Jacobian. */
+    virtual bool has_analytic_jacobian() const;
+
+    //! Selects the element kernel for the mesh dimension and axisymmetry
+    virtual void auxiliary_init( MultiphysicsSystem& system );
+
+    //! First half step of split chemistry, see chemistry_split()
+    virtual void pre_solve( MultiphysicsSystem& system );
+
+    //! Second half step of split chemistry, see chemistry_split()
+    virtual void post_solve( MultiphysicsSystem& system );
+
     // Time dependent part(s)
     virtual void element_time_derivative( bool compute_jacobian,
 					  AssemblyContext& context,
@@ -62,6 +79,9 @@ namespace GRINS
                                   AssemblyContext& context,
                                   CachedValues& cache );
 
+    //! Pressure pinning is done on every side, otherwise only Neumann ids need work
+    virtual bool side_work_boundary_ids( std::set<BoundaryID>& bc_ids ) const;
+
     // Mass matrix part(s)
     virtual void mass_residual( bool compute_jacobian,
 				AssemblyContext& context,
@@ -82,11 +102,73 @@ namespace GRINS
 
   protected:
 
+    //! Whether the chemical source terms are operator split from transport
+    /*! With split_chemistry enabled, unsteady solves use Strang splitting:
+        pre_solve() integrates the chemistry at each node over dt/2, the time
+        solver then advances convection, diffusion and heat release free
+        of the stiff kinetics, and post_solve() integrates the chemistry over
+        the second dt/2. Steady (and pseudo-transient) solves keep the
+        chemistry in the residual. The half steps use the deltat at the start
+        of the step and only the old solution of a plain EulerSolver is
+        updated, so pre_solve() errors out for bdf2, esdirk, target_tolerance
+        (step doubling) and backtrack_deltat. */
+    bool chemistry_split() const
+    { return _split_chemistry && !this->_is_steady; }
+
+    //! Integrate the chemistry over dt at every local node of the solution
+    void integrate_chemistry( MultiphysicsSystem& system, libMesh::Real dt );
+
+    //! Analytic Jacobian of the element_time_derivative residual
+    /*! Includes the state dependence of density, mixture molar mass, cp
+        (through cp_s in Y and dcp_dT() in T), species enthalpies, and the
+        chemical source terms (through
+        Evaluator::omega_dot_and_state_derivs, unless chemistry_split(); with
+        kinetics ISAT these are the record gradients of the tabulated
+        omega_dot the residual uses). Viscosity
+        is constant. With constant conductivity, rho*D_s = k/(Le*cp) varies
+        through cp; with constant Prandtl number, k = mu*cp/Pr varies through
+        cp and rho*D_s is constant. Other transport models are not
+        differentiated, see has_analytic_jacobian(). */
+    template<unsigned int Dim, bool is_axisymmetric>
+    void assemble_element_time_derivative_jacobian( AssemblyContext& context,
+                                                    const CachedValues& cache );
+
+    //! Mixture dcp/dT = sum_s Y_s dcp_s/dT
+    /*! Uses the analytic species derivatives from Evaluator::dcp_s_dT(),
+        which are written to dcp_s_dT. */
+    libMesh::Real dcp_dT( Evaluator& gas_evaluator,
+                          libMesh::Real T,
+                          const std::vector<libMesh::Real>& Y,
+                          std::vector<libMesh::Real>& dcp_s_dT ) const;
+
+    //! Interior residual and Jacobian, specialized on dimension and axisymmetry
+    /*! Dimension and axisymmetry are compile time constants here, so their
+        branches and the unused velocity components drop out of the DoF loops. */
+    template<unsigned int Dim, bool is_axisymmetric>
+    void element_time_derivative_kernel( bool compute_jacobian,
+                                         AssemblyContext& context,
+                                         CachedValues& cache );
+
     //! Enable pressure pinning
     bool _pin_pressure;
     
     PressurePinning _p_pinning;
 
+    //! Integrate the chemical source terms separately from transport
+    bool _split_chemistry;
+
+    //! Largest change in T (relative) or Y (absolute) over one chemistry substep
+    libMesh::Real _split_chemistry_max_change;
+
+    //! Limit on chemistry substeps per node and half step
+    unsigned int _split_chemistry_max_substeps;
+
+    //! Time step of the current transport solve, for the half step in post_solve()
+    libMesh::Real _split_deltat;
+
+    //! Boundary ids with catalytic walls, the only sides needing the side cache
+    std::set<BoundaryID> _catalytic_wall_ids;
+
     //! Index from registering this quantity
     unsigned int _rho_index;
 
@@ -111,6 +193,12 @@ namespace GRINS
     //! Index from registering this quantity. Each species will have it's own index.
     std::vector<unsigned int> _omega_dot_index;
 
+    typedef void (ReactingLowMachNavierStokes<Mixture,Evaluator>::*ElementKernel)
+      ( bool, AssemblyContext&, CachedValues& );
+
+    //! Kernel used by element_time_derivative(), chosen in auxiliary_init()
+    ElementKernel _element_time_derivative_kernel;
+
   private:
 
     ReactingLowMachNavierStokes();
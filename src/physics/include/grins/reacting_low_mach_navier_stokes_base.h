@@ -32,6 +32,7 @@
 #include "grins/physics.h"
 #include "grins/pressure_pinning.h"
 #include "grins/assembly_context.h"
+#include "grins/evaluator_pool.h"
 
 namespace GRINS
 {
@@ -73,10 +74,23 @@ namespace GRINS
 
     const Mixture& gas_mixture() const;
 
+    //! Print statistics of the species source term ISAT table, if enabled
+    virtual void print_statistics( const libMesh::Parallel::Communicator& comm,
+                                   std::ostream& out ) const;
+
+    //! Evaluator for the current thread
+    /*! The Evaluator is taken from _evaluator_pool the first time a given
+        context asks for it and stays attached to that context, so it is
+        not rebuilt for every element. */
+    Evaluator& gas_evaluator( const AssemblyContext& context ) const;
+
   protected:
 
     Mixture _gas_mixture;
 
+    //! Evaluators shared across contexts. Must be declared after _gas_mixture.
+    mutable EvaluatorPool<Evaluator,Mixture> _evaluator_pool;
+
     libMesh::Number _p0;
 
     //! Physical dimension of problem
@@ -125,6 +139,23 @@ namespace GRINS
   unsigned int ReactingLowMachNavierStokesBase<Mixture,Evaluator>::n_species() const
   { return _n_species; }
 
+  template<typename Mixture, typename Evaluator>
+  inline
+  Evaluator& ReactingLowMachNavierStokesBase<Mixture,Evaluator>::gas_evaluator( const AssemblyContext& context ) const
+  {
+    typedef PooledEvaluator<Evaluator,Mixture> PooledType;
+
+    AssemblyContextData* data = context.get_physics_data(this);
+
+    if( !data )
+      {
+        data = new PooledType(_evaluator_pool);
+        context.set_physics_data(this, data);
+      }
+
+    return libMesh::libmesh_cast_ptr<PooledType*>(data)->evaluator();
+  }
+
 
   template<typename Mixture, typename Evaluator>
   inline
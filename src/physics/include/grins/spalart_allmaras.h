@@ -62,14 +62,27 @@ namespace GRINS
 
     ~SpalartAllmaras();
 
+    //! Element Jacobians are only available through automatic differentiation
+    virtual bool has_analytic_jacobian() const;
+
+    //! Residuals depend on the velocity and the turbulence viscosity
+    virtual void residual_dependencies( std::set<VariableIndex>& vars ) const;
+
     virtual void init_variables( libMesh::FEMSystem* system );
 
     //! Sets velocity variables to be time-evolving
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
+    //! Tabulates the wall distance at quadrature points if the mesh has changed
+    virtual void pre_solve( MultiphysicsSystem& system );
+
     // Context initialization
     virtual void init_context( AssemblyContext& context );
 
+    //! Caches the wall distance at quadrature points as Cache::WALL_DISTANCE
+    virtual void compute_element_time_derivative_cache( const AssemblyContext& context,
+                                                        CachedValues& cache );
+
     // Element time derivative
     virtual void element_time_derivative(bool compute_jacobian, AssemblyContext& context, CachedValues& /*cache*/);
 
@@ -86,6 +99,33 @@ namespace GRINS
 
   protected:
 
+    //! Fill Cache::WALL_DISTANCE at the element quadrature points
+    /*! Uses the values tabulated by distance_function, interpolating only
+        if the element is not in the table. */
+    void compute_wall_distance_cache( const AssemblyContext& context,
+                                      CachedValues& cache );
+
+    //! Residual of the turbulent viscosity equation on the current element
+    /*! Templated on the scalar type: with libMesh::Real this is the residual,
+        with DualNumber<N> it also carries derivatives with respect to whichever
+        coefficients were seeded. The coefficient vectors hold the element
+        solution of each variable; w_coeffs is unused in 2D. */
+    template<typename Scalar>
+    void element_time_derivative_kernel( AssemblyContext& context,
+                                         const std::vector<libMesh::Real>& distance_qp,
+                                         const std::vector<Scalar>& u_coeffs,
+                                         const std::vector<Scalar>& v_coeffs,
+                                         const std::vector<Scalar>& w_coeffs,
+                                         const std::vector<Scalar>& nu_coeffs,
+                                         std::vector<Scalar>& Fnu );
+
+    //! Residual and exact Jacobian of element_time_derivative_kernel
+    /*! Seeds the velocity and turbulent viscosity dofs, in that order, of
+        DualNumber<N> coefficients, so N must be at least the number of them. */
+    template<unsigned int N>
+    void element_time_derivative_ad( AssemblyContext& context,
+                                     const std::vector<libMesh::Real>& distance_qp );
+
     // The flow variables
     PrimitiveFlowFEVariables _flow_vars;
 
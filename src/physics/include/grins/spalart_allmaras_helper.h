@@ -33,6 +33,9 @@
 //Utils
 #include "grins/distance_function.h"
 
+// C++
+#include <cmath>
+
 namespace GRINS
 {
   class SpalartAllmarasHelper
@@ -48,6 +51,14 @@ namespace GRINS
     // The vorticity function
     libMesh::Real vorticity(AssemblyContext& context, unsigned int qp) const;
 
+    //! The vorticity from the velocity gradients
+    /*! Scalar may be a DualNumber. In 3D the square root is skipped where
+        its argument vanishes, e.g. in quiescent or uniform flow: its
+        derivative is infinite there and would turn the zero derivatives
+        of the argument into NaN. */
+    template<typename Scalar>
+    Scalar vorticity( const Scalar grad_u[3], const Scalar grad_v[3], const Scalar grad_w[3] ) const;
+
   protected:
 
     // Physical dimension
@@ -62,6 +73,33 @@ namespace GRINS
 
   };
 
+  template<typename Scalar>
+  inline
+  Scalar SpalartAllmarasHelper::vorticity( const Scalar grad_u[3],
+                                           const Scalar grad_v[3],
+                                           const Scalar grad_w[3] ) const
+  {
+    using std::fabs;
+    using std::sqrt;
+
+    Scalar vorticity_value = fabs(grad_v[0] - grad_u[1]);
+
+    if(this->_dim == 3)
+      {
+        Scalar vorticity_component_0 = grad_w[1] - grad_v[2];
+        Scalar vorticity_component_1 = grad_u[2] - grad_v[0];
+
+        Scalar term = vorticity_component_0*vorticity_component_0
+          + vorticity_component_1*vorticity_component_1
+          + vorticity_value*vorticity_value;
+
+        if( term != 0.0 )
+          vorticity_value += sqrt(term);
+      }
+
+    return vorticity_value;
+  }
+
 } //End namespace block
 
 #endif // GRINS_SPALART_ALLMARAS_HELPER_H
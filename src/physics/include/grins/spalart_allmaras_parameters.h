@@ -25,6 +25,9 @@
 #ifndef GRINS_SPALART_ALLMARAS_PARAMETERS_H
 #define GRINS_SPALART_ALLMARAS_PARAMETERS_H
 
+// C++
+#include <cmath>
+
 // libMesh
 #include "libmesh/libmesh.h"
 class GetPot;
@@ -33,7 +36,9 @@ namespace GRINS
 {
   //! Encapsulate Spalart-Allmaras model parameters
   /*! This is mostly a container class, but there are a few helper functions
-      here that are used in different places in SpalartAllmaras classes. */
+      here that are used in different places in SpalartAllmaras classes.
+      The helper functions are templated on the scalar type of the turbulent
+      viscosity so they can be used from automatically differentiated kernels. */
   class SpalartAllmarasParameters
   {
   public:
@@ -43,16 +48,19 @@ namespace GRINS
     ~SpalartAllmarasParameters(){};
 
     // The source function \f$ \tilde{S} \f$
-    libMesh::Real source_fn( libMesh::Number nu, libMesh::Real mu,
-                             libMesh::Real wall_distance, libMesh::Real vorticity_value) const;
+    template<typename Scalar>
+    Scalar source_fn( const Scalar& nu, libMesh::Real mu,
+                      libMesh::Real wall_distance, const Scalar& vorticity_value) const;
 
     // The destruction function \f$ f_w(\nu) \f$
-    libMesh::Real destruction_fn( libMesh::Number nu, libMesh::Real wall_distance,
-                                  libMesh::Real S_tilde) const;
+    template<typename Scalar>
+    Scalar destruction_fn( const Scalar& nu, libMesh::Real wall_distance,
+                           const Scalar& S_tilde) const;
 
     //! Helper function
     /*! This expression appears in a couple of places so we provide a function for it*/
-    libMesh::Real fv1( libMesh::Real chi ) const;
+    template<typename Scalar>
+    Scalar fv1( const Scalar& chi ) const;
 
     libMesh::Real get_kappa() const
     { return _kappa;}
@@ -120,16 +128,76 @@ namespace GRINS
 
   };
 
+  template<typename Scalar>
   inline
-  libMesh::Real SpalartAllmarasParameters::fv1( libMesh::Real chi ) const
+  Scalar SpalartAllmarasParameters::fv1( const Scalar& chi ) const
   {
-    libMesh::Real chi3 = chi*chi*chi;
+    Scalar chi3 = chi*chi*chi;
     libMesh::Real cv1 = this->get_cv1();
     libMesh::Real cv13 = cv1*cv1*cv1;
 
     return chi3/(chi3 + cv13);
   }
 
+  template<typename Scalar>
+  inline
+  Scalar SpalartAllmarasParameters::source_fn( const Scalar& nu, libMesh::Real mu,
+                                               libMesh::Real wall_distance,
+                                               const Scalar& vorticity_value) const
+  {
+    using std::pow;
+
+    // Step 1
+    Scalar chi = nu/mu;
+
+    // Step 2
+    Scalar fv1 = this->fv1(chi);
+
+    // Step 3
+    Scalar fv2 = 1 - (chi/(1 + chi*fv1));
+
+    // Step 4
+    Scalar S_bar = nu/(pow(_kappa, 2.0) * pow(wall_distance, 2.0))*(fv2) ;
+
+    // Step 5, the absolute value of the vorticity
+    Scalar S = vorticity_value;
+
+    // Step 6
+    Scalar S_tilde = 0.0;
+    if(S_bar >= -this->_cv2*S)
+      {
+        S_tilde = S + S_bar;
+      }
+    else
+      {
+        S_tilde = S + (S*(pow(this->_cv2,2.0)*S + this->_cv3*S_bar))/((this->_cv3 - (2*this->_cv2))*S - S_bar);
+      }
+
+    return S_tilde;
+  }
+
+  template<typename Scalar>
+  inline
+  Scalar SpalartAllmarasParameters::destruction_fn( const Scalar& nu, libMesh::Real wall_distance,
+                                                    const Scalar& S_tilde) const
+  {
+    using std::pow;
+
+    // Step 1
+    Scalar r = nu/(S_tilde*pow(this->_kappa,2.0)*pow(wall_distance,2.0));
+
+    if( this->_r_lin < r )
+      r = this->_r_lin;
+
+    // Step 2
+    Scalar g = r + this->_c_w2*(pow(r,6.0) - r);
+
+    // Step 3
+    Scalar fw = g*pow((1 + pow(this->_c_w3,6.0))/(pow(g,6.0) + pow(this->_c_w3,6.0)), 1.0/6.0);
+
+    return fw;
+  }
+
 } // end namespace GRINS
 
 #endif // GRINS_SPALART_ALLMARAS_PARAMETERS_H
@@ -40,6 +40,9 @@ namespace GRINS
     SpalartAllmarasSPGSMStabilization( const GRINS::PhysicsName& physics_name, const GetPot& input );
     virtual ~SpalartAllmarasSPGSMStabilization();
 
+    //! Element Jacobians are not implemented for the stabilization terms
+    virtual bool has_analytic_jacobian() const;
+
     virtual void init_variables( libMesh::FEMSystem* system );
 
     virtual void element_time_derivative( bool compute_jacobian,
@@ -0,0 +1,325 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_STIFF_CHEMISTRY_INTEGRATOR_H
+#define GRINS_STIFF_CHEMISTRY_INTEGRATOR_H
+
+// C++
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+
+namespace GRINS
+{
+  //! Integrates the chemical source terms of a single point over a time interval
+  /*!
+    Advances mass fractions Y and temperature T through
+    \f$ dY_s/dt = \dot{\omega}_s/\rho \f$ and
+    \f$ dT/dt = -\sum_s h_s \dot{\omega}_s/(\rho c_p) \f$
+    with backward Euler substeps, each solved by Newton iteration with the
+    analytic Jacobian from Evaluator::omega_dot_and_derivs. The density is
+    either fixed or follows the ideal gas law at the given thermodynamic
+    pressure. Substeps are halved when Newton fails or the state changes by
+    more than max_change (relative in T, absolute in Y) and grown again
+    after easy steps, so stiff kinetics are taken in few, large steps.
+   */
+  template<typename Evaluator>
+  class StiffChemistryIntegrator
+  {
+  public:
+
+    //! fixed_rho <= 0 means the density follows the ideal gas law
+    StiffChemistryIntegrator( Evaluator& evaluator,
+                              unsigned int n_species,
+                              libMesh::Real fixed_rho,
+                              libMesh::Real max_change,
+                              unsigned int max_substeps );
+
+    //! Advance T and Y over dt at thermodynamic pressure p0. Returns the number of substeps taken.
+    unsigned int integrate( libMesh::Real dt, libMesh::Real p0,
+                            libMesh::Real& T, std::vector<libMesh::Real>& Y );
+
+  protected:
+
+    //! One backward Euler step of size h from (T_old,Y_old). Returns false if Newton did not converge.
+    bool backward_euler_step( libMesh::Real h, libMesh::Real p0,
+                              libMesh::Real T_old, const std::vector<libMesh::Real>& Y_old,
+                              libMesh::Real& T, std::vector<libMesh::Real>& Y );
+
+    //! Right hand side f(T,Y) and its Jacobian, unknowns ordered (Y_0,...,Y_{n-1},T)
+    void evaluate( libMesh::Real p0, libMesh::Real T, const std::vector<libMesh::Real>& Y );
+
+    Evaluator& _evaluator;
+
+    const unsigned int _n_species;
+
+    const libMesh::Real _fixed_rho;
+
+    const libMesh::Real _max_change;
+
+    const unsigned int _max_substeps;
+
+    // Work space, reused over substeps and Newton iterations
+    std::vector<libMesh::Real> _Y_clipped;
+    std::vector<libMesh::Real> _omega_dot;
+    std::vector<libMesh::Real> _domega_dot_dT;
+    std::vector<std::vector<libMesh::Real> > _domega_dot_drho_s;
+    std::vector<libMesh::Real> _drho_dY;
+    std::vector<libMesh::Real> _cp_s;
+    std::vector<libMesh::Real> _h;
+
+    libMesh::DenseVector<libMesh::Real> _f;
+    libMesh::DenseMatrix<libMesh::Real> _df;
+
+  private:
+
+    StiffChemistryIntegrator();
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+
+  template<typename Evaluator>
+  inline
+  StiffChemistryIntegrator<Evaluator>::StiffChemistryIntegrator( Evaluator& evaluator,
+                                                                 unsigned int n_species,
+                                                                 libMesh::Real fixed_rho,
+                                                                 libMesh::Real max_change,
+                                                                 unsigned int max_substeps )
+    : _evaluator(evaluator),
+      _n_species(n_species),
+      _fixed_rho(fixed_rho),
+      _max_change(max_change),
+      _max_substeps(max_substeps),
+      _Y_clipped(n_species,0.0),
+      _omega_dot(n_species,0.0),
+      _domega_dot_dT(n_species,0.0),
+      _domega_dot_drho_s(n_species, std::vector<libMesh::Real>(n_species,0.0)),
+      _drho_dY(n_species,0.0),
+      _cp_s(n_species,0.0),
+      _h(n_species,0.0),
+      _f(n_species+1),
+      _df(n_species+1,n_species+1)
+  {
+    return;
+  }
+
+  template<typename Evaluator>
+  inline
+  unsigned int StiffChemistryIntegrator<Evaluator>::integrate( libMesh::Real dt, libMesh::Real p0,
+                                                               libMesh::Real& T, std::vector<libMesh::Real>& Y )
+  {
+    libmesh_assert_equal_to( Y.size(), _n_species );
+
+    std::vector<libMesh::Real> Y_old(Y);
+    libMesh::Real T_old = T;
+
+    libMesh::Real t = 0.0;
+    libMesh::Real h = dt;
+    unsigned int n_steps = 0;
+    unsigned int n_attempts = 0;
+
+    while( t < dt )
+      {
+        if( n_attempts++ >= _max_substeps )
+          {
+            std::cerr << "Error: chemistry integration did not finish within "
+                      << _max_substeps << " substeps." << std::endl
+                      << "       T = " << T_old << ", t = " << t << " of dt = " << dt << std::endl;
+            libmesh_error();
+          }
+
+        h = std::min( h, dt - t );
+
+        // Start Newton from the current state
+        T = T_old;
+        Y = Y_old;
+
+        const bool converged = this->backward_euler_step( h, p0, T_old, Y_old, T, Y );
+
+        libMesh::Real change = 0.0;
+        if( converged )
+          {
+            change = std::abs(T - T_old)/T_old;
+            for( unsigned int s = 0; s < _n_species; s++ )
+              change = std::max( change, std::abs(Y[s] - Y_old[s]) );
+          }
+
+        if( !converged || change > _max_change )
+          {
+            h *= 0.5;
+            continue;
+          }
+
+        t += h;
+        n_steps++;
+        T_old = T;
+        Y_old = Y;
+
+        if( change < 0.5*_max_change )
+          h *= 2.0;
+      }
+
+    return n_steps;
+  }
+
+  template<typename Evaluator>
+  inline
+  bool StiffChemistryIntegrator<Evaluator>::backward_euler_step( libMesh::Real h, libMesh::Real p0,
+                                                                 libMesh::Real T_old, const std::vector<libMesh::Real>& Y_old,
+                                                                 libMesh::Real& T, std::vector<libMesh::Real>& Y )
+  {
+    const unsigned int n = _n_species + 1;
+    const unsigned int max_newton_iterations = 10;
+    const libMesh::Real tol = 1.0e-10;
+
+    libMesh::DenseVector<libMesh::Real> residual(n), delta(n);
+
+    for( unsigned int it = 0; it < max_newton_iterations; it++ )
+      {
+        this->evaluate( p0, T, Y );
+
+        // G(z) = z - z_old - h*f(z), dG/dz = I - h*df/dz
+        for( unsigned int s = 0; s < _n_species; s++ )
+          residual(s) = -( Y[s] - Y_old[s] - h*_f(s) );
+        residual(_n_species) = -( T - T_old - h*_f(_n_species) )/T_old;
+
+        for( unsigned int i = 0; i < n; i++ )
+          {
+            for( unsigned int j = 0; j < n; j++ )
+              _df(i,j) *= -h;
+            _df(i,i) += 1.0;
+          }
+
+        // Scale the temperature row so its residual is relative, like the mass fractions
+        for( unsigned int j = 0; j < n; j++ )
+          _df(_n_species,j) /= T_old;
+
+        _df.lu_solve( residual, delta );
+
+        libMesh::Real update = std::abs(delta(_n_species))/T_old;
+        for( unsigned int s = 0; s < _n_species; s++ )
+          {
+            Y[s] += delta(s);
+            update = std::max( update, std::abs(delta(s)) );
+          }
+        T += delta(_n_species);
+
+        if( !(T > 0.0) )
+          return false;
+
+        if( update < tol )
+          return true;
+      }
+
+    return false;
+  }
+
+  template<typename Evaluator>
+  inline
+  void StiffChemistryIntegrator<Evaluator>::evaluate( libMesh::Real p0, libMesh::Real T,
+                                                      const std::vector<libMesh::Real>& Y )
+  {
+    const bool fixed_density = (_fixed_rho > 0.0);
+
+    // Kinetics are only defined for nonnegative mass fractions
+    for( unsigned int s = 0; s < _n_species; s++ )
+      _Y_clipped[s] = std::max( Y[s], 0.0 );
+
+    const libMesh::Real R_mix = _evaluator.R_mix( _Y_clipped );
+    const libMesh::Real rho = fixed_density ? _fixed_rho : p0/(R_mix*T);
+    const libMesh::Real cp = _evaluator.cp( T, _Y_clipped );
+
+    const libMesh::Real drho_dT = fixed_density ? 0.0 : -rho/T;
+    for( unsigned int t = 0; t < _n_species; t++ )
+      _drho_dY[t] = fixed_density ? 0.0 : -rho*_evaluator.R(t)/R_mix;
+
+    _evaluator.cp_s( T, _cp_s );
+    _evaluator.omega_dot_and_derivs( T, rho, _Y_clipped, _omega_dot, _domega_dot_dT, _domega_dot_drho_s );
+
+    libMesh::Real chem = 0.0;
+    for( unsigned int s = 0; s < _n_species; s++ )
+      {
+        _h[s] = _evaluator.h_s( T, s );
+        chem += _h[s]*_omega_dot[s];
+      }
+
+    _f.zero();
+    _df.resize( _n_species+1, _n_species+1 );
+
+    libMesh::Real dchem_dT = 0.0;
+
+    for( unsigned int s = 0; s < _n_species; s++ )
+      {
+        // Chain the fixed partial density derivatives through rho(T,Y), as in the Jacobian assembly
+        libMesh::Real A = 0.0;
+        for( unsigned int t = 0; t < _n_species; t++ )
+          A += _domega_dot_drho_s[s][t]*_Y_clipped[t];
+
+        const libMesh::Real domega_dot_dT = _domega_dot_dT[s] + A*drho_dT;
+
+        _f(s) = _omega_dot[s]/rho;
+
+        _df(s,_n_species) = domega_dot_dT/rho - _omega_dot[s]*drho_dT/(rho*rho);
+
+        for( unsigned int t = 0; t < _n_species; t++ )
+          {
+            const libMesh::Real domega_dot_dY = rho*_domega_dot_drho_s[s][t] + A*_drho_dY[t];
+
+            _df(s,t) = domega_dot_dY/rho - _omega_dot[s]*_drho_dY[t]/(rho*rho);
+
+            // d(chem)/dY_t = sum_s h_s domega_dot_s/dY_t, accumulated in the T row for now
+            _df(_n_species,t) += _h[s]*domega_dot_dY;
+          }
+
+        dchem_dT += _cp_s[s]*_omega_dot[s] + _h[s]*domega_dot_dT;
+      }
+
+    // f_T = -chem/(rho*cp); the temperature dependence of cp is neglected
+    const libMesh::Real rho_cp = rho*cp;
+
+    _f(_n_species) = -chem/rho_cp;
+
+    _df(_n_species,_n_species) = -dchem_dT/rho_cp + chem*drho_dT*cp/(rho_cp*rho_cp);
+
+    for( unsigned int t = 0; t < _n_species; t++ )
+      {
+        const libMesh::Real dchem_dY = _df(_n_species,t);
+
+        _df(_n_species,t) = -dchem_dY/rho_cp + chem*(_drho_dY[t]*cp + rho*_cp_s[t])/(rho_cp*rho_cp);
+      }
+
+    return;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_STIFF_CHEMISTRY_INTEGRATOR_H
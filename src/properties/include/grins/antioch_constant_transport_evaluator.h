@@ -78,6 +78,29 @@ namespace GRINS
     void D( const libMesh::Real rho, const libMesh::Real cp,
             const libMesh::Real k,
 	    std::vector<libMesh::Real>& D );
+
+    // Element-batched evaluation, see AntiochEvaluator
+    void mu_and_k( const std::vector<libMesh::Real>& T,
+                   const std::vector<std::vector<libMesh::Real> >& Y,
+                   std::vector<libMesh::Real>& mu,
+                   std::vector<libMesh::Real>& k );
+
+    void D( const std::vector<libMesh::Real>& rho,
+            const std::vector<libMesh::Real>& cp,
+            const std::vector<libMesh::Real>& k,
+            std::vector<std::vector<libMesh::Real> >& D_s );
+
+    //! Evaluate all transport, thermo, and kinetic properties over an element
+    /*! Temperature, density, and mass fractions at each quadrature point are taken
+        from the cache. All outputs are indexed by quadrature point and must already
+        be sized. cp and k are computed once and reused for the diffusivities. */
+    void compute_element_properties( const CachedValues& cache,
+                                     std::vector<libMesh::Real>& mu,
+                                     std::vector<libMesh::Real>& k,
+                                     std::vector<libMesh::Real>& cp,
+                                     std::vector<std::vector<libMesh::Real> >& h_s,
+                                     std::vector<std::vector<libMesh::Real> >& D_s,
+                                     std::vector<std::vector<libMesh::Real> >& omega_dot );
     
   protected:
 
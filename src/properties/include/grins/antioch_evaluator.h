@@ -35,6 +35,7 @@
 #include "grins/antioch_kinetics.h"
 #include "grins/cached_values.h"
 #include "grins/property_types.h"
+#include "grins/tabulated_thermo.h"
 
 // Antioch
 #include "antioch/temp_cache.h"
@@ -95,6 +96,14 @@ namespace GRINS
     libMesh::Real cp( const libMesh::Real& T,
                       const std::vector<libMesh::Real>& Y );
 
+    //! Species specific heats at constant pressure, [J/kg-K]
+    void cp_s( const libMesh::Real& T, std::vector<libMesh::Real>& cp_s );
+
+    //! Temperature derivatives of the species specific heats, [J/kg-K^2]
+    /*! Differentiates the CEA or statistical mechanics expressions, or for
+        TabulatedThermo the table interpolant, so it is consistent with cp_s(). */
+    void dcp_s_dT( const libMesh::Real& T, std::vector<libMesh::Real>& dcp_s_dT );
+
     // Kinetics
     void omega_dot( const CachedValues& cache, unsigned int qp,
 		    std::vector<libMesh::Real>& omega_dot );
@@ -103,6 +112,68 @@ namespace GRINS
                     const std::vector<libMesh::Real> mass_fractions,
                     std::vector<libMesh::Real>& omega_dot );
 
+    //! omega_dot and derivatives, as needed for analytic Jacobians
+    /*! See AntiochKinetics::omega_dot_and_derivs for the meaning of the derivatives. */
+    void omega_dot_and_derivs( const libMesh::Real& T, libMesh::Real rho,
+                               const std::vector<libMesh::Real>& mass_fractions,
+                               std::vector<libMesh::Real>& omega_dot,
+                               std::vector<libMesh::Real>& domega_dot_dT,
+                               std::vector<std::vector<libMesh::Real> >& domega_dot_drho_s );
+
+    //! omega_dot and derivatives with respect to (T, rho, Y)
+    /*! When kinetics ISAT is enabled these are the tabulated omega_dot and
+        its record gradient, consistent with the residual; see
+        KineticsISAT::omega_dot_and_derivs. */
+    void omega_dot_and_state_derivs( const libMesh::Real& T, libMesh::Real rho,
+                                     const std::vector<libMesh::Real>& mass_fractions,
+                                     std::vector<libMesh::Real>& omega_dot,
+                                     std::vector<libMesh::Real>& domega_dot_dT,
+                                     std::vector<libMesh::Real>& domega_dot_drho,
+                                     std::vector<std::vector<libMesh::Real> >& domega_dot_dY );
+
+    // Element-batched evaluation
+    /* Each of these evaluates a single property at all quadrature points
+       of an element. Inputs and outputs are indexed by quadrature point
+       (and then species), and outputs must already be sized. Looping over
+       quadrature points inside one property keeps the same polynomial/rate
+       evaluation hot for the whole element instead of alternating between
+       properties at every point. */
+    void cp( const std::vector<libMesh::Real>& T,
+             const std::vector<std::vector<libMesh::Real> >& Y,
+             std::vector<libMesh::Real>& cp );
+
+    void h_s( const std::vector<libMesh::Real>& T,
+              std::vector<std::vector<libMesh::Real> >& h_s );
+
+    void omega_dot( const std::vector<libMesh::Real>& T,
+                    const std::vector<libMesh::Real>& rho,
+                    const std::vector<std::vector<libMesh::Real> >& Y,
+                    std::vector<std::vector<libMesh::Real> >& omega_dot );
+
+    //! Fused evaluation of cp, species enthalpies, and omega_dot over an element
+    /*! Same input/output layout as the batched methods above. A single temperature
+        cache per quadrature point is shared by all three and, for CEA thermo, the
+        h/RT values behind h_s are reused for the h/RT - s/R needed by the kinetics,
+        so each species' NASA polynomials are evaluated once per point. For
+        TabulatedThermo all three come from table lookups. */
+    void thermochemistry( const std::vector<libMesh::Real>& T,
+                          const std::vector<libMesh::Real>& rho,
+                          const std::vector<std::vector<libMesh::Real> >& Y,
+                          std::vector<libMesh::Real>& cp,
+                          std::vector<std::vector<libMesh::Real> >& h_s,
+                          std::vector<std::vector<libMesh::Real> >& omega_dot );
+
+    //! thermochemistry(), unless the mixture has an ISAT table for omega_dot
+    /*! With ISAT enabled, cp and h_s are evaluated with the batched methods
+        and omega_dot is retrieved from the table where possible. An empty
+        omega_dot skips the kinetics, for chemistry integrated separately. */
+    void element_thermochemistry( const std::vector<libMesh::Real>& T,
+                                  const std::vector<libMesh::Real>& rho,
+                                  const std::vector<std::vector<libMesh::Real> >& Y,
+                                  std::vector<libMesh::Real>& cp,
+                                  std::vector<std::vector<libMesh::Real> >& h_s,
+                                  std::vector<std::vector<libMesh::Real> >& omega_dot );
+
   protected:
 
     const AntiochMixture& _chem;
@@ -112,11 +183,20 @@ namespace GRINS
 
     boost::scoped_ptr<AntiochKinetics> _kinetics;
 
+    //! Temperature referenced by _temp_cache. Must be declared before _temp_cache.
+    /*! Antioch::TempCache only holds a reference to T, so we keep our own copy
+        rather than referencing the caller's, which may be a temporary. */
+    libMesh::Real _temp_cache_T;
+
     boost::scoped_ptr<Antioch::TempCache<libMesh::Real> > _temp_cache;
 
+    //! Work array for thermochemistry(), sized to the number of species
+    std::vector<libMesh::Real> _h_RT_minus_s_R;
+
+    //! ISAT work arrays for this thread, NULL unless the mixture has an ISAT table
+    boost::scoped_ptr<KineticsISAT::Workspace> _isat_workspace;
+
     //! Helper method for managing _temp_cache
-    /*! T *MUST* be pass-by-reference because of the structure
-        of Antioch::TempCache! */
     void check_and_reset_temp_cache( const libMesh::Real& T );
 
     /* Below we will specialize the specialized_build_* functions to the appropriate type.
@@ -146,6 +226,21 @@ namespace GRINS
       return;
     }
 
+    void specialized_build_thermo( const AntiochMixture& mixture,
+                                   boost::scoped_ptr<TabulatedThermo>& thermo,
+                                   thermo_type<TabulatedThermo> )
+    {
+      if( !mixture.tabulated_thermo() )
+        {
+          std::cerr << "Error: TabulatedThermo requires Physics/Antioch/thermo_model = tabulated" << std::endl
+                    << "       so that AntiochMixture builds the thermo tables." << std::endl;
+          libmesh_error();
+        }
+
+      thermo.reset( new TabulatedThermo( mixture ) );
+      return;
+    }
+
   };
 
   /* ------------------------- Inline Functions -------------------------*/
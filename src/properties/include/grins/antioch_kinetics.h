@@ -66,6 +66,35 @@ namespace GRINS
                     const std::vector<libMesh::Real>& mass_fractions,
                     std::vector<libMesh::Real>& omega_dot );
 
+    //! Evaluate omega_dot with h/RT - s/R already computed by the caller
+    /*! Lets the thermo evaluation share the NASA polynomial evaluations with
+        the equilibrium constants instead of recomputing them here. */
+    void omega_dot( const libMesh::Real T,
+                    const libMesh::Real rho,
+                    const std::vector<libMesh::Real>& mass_fractions,
+                    const std::vector<libMesh::Real>& h_RT_minus_s_R,
+                    std::vector<libMesh::Real>& omega_dot );
+
+    //! Evaluate omega_dot and its derivatives
+    /*! domega_dot_dT is taken at fixed partial densities. domega_dot_drho_s[s][t]
+        is the derivative of omega_dot[s] w.r.t. the partial density rho*Y[t]
+        of species t. Derivatives come straight from Antioch, including the
+        temperature dependence of the equilibrium constants. */
+    void omega_dot_and_derivs( const Antioch::TempCache<libMesh::Real>& temp_cache,
+                               const libMesh::Real rho,
+                               const std::vector<libMesh::Real>& mass_fractions,
+                               std::vector<libMesh::Real>& omega_dot,
+                               std::vector<libMesh::Real>& domega_dot_dT,
+                               std::vector<std::vector<libMesh::Real> >& domega_dot_drho_s );
+
+    //! Evaluate omega_dot at every quadrature point of an element
+    /*! T, rho, and mass_fractions are indexed by quadrature point, as is
+        omega_dot. */
+    void omega_dot( const std::vector<libMesh::Real>& T,
+                    const std::vector<libMesh::Real>& rho,
+                    const std::vector<std::vector<libMesh::Real> >& mass_fractions,
+                    std::vector<std::vector<libMesh::Real> >& omega_dot );
+
   protected:
 
     const AntiochMixture& _antioch_mixture;
@@ -74,6 +103,13 @@ namespace GRINS
 
     Antioch::CEAEvaluator<libMesh::Real> _antioch_cea_thermo;
 
+    //! Work arrays, sized once here instead of on every omega_dot call
+    std::vector<libMesh::Real> _h_RT_minus_s_R;
+
+    std::vector<libMesh::Real> _molar_densities;
+
+    std::vector<libMesh::Real> _dh_RT_minus_s_R_dT;
+
   private:
 
     AntiochKinetics();
@@ -33,6 +33,8 @@
 // GRINS
 #include "grins/antioch_chemistry.h"
 #include "grins/property_types.h"
+#include "grins/property_table.h"
+#include "grins/kinetics_isat.h"
 
 // libMesh
 #include "libmesh/libmesh_common.h"
@@ -56,6 +58,9 @@ namespace GRINS
   /*!
     This class is expected to be constructed *before* threads have been forked and will
     live during the whole program.
+    If Physics/Antioch/thermo_model is tabulated, the TabulatedThermo tables are built
+    here, once, using Physics/Antioch/tabulation options, and shared read-only by all
+    evaluators.
     By default, Antioch is working in SI units. Note that this documentation will always
     be built regardless if Antioch is included in the GRINS build or not. Check configure
     output to confirm that Antioch was included in the build.
@@ -74,6 +79,35 @@ namespace GRINS
 
     libMesh::Real h_stat_mech_ref_correction( unsigned int species ) const;
 
+    //! Temperature derivative of the CEA curve fit species cp [J/kg-K^2]
+    libMesh::Real cea_dcp_dT( unsigned int species, libMesh::Real T ) const;
+
+    //! Temperature derivative of the statistical mechanics species cp [J/kg-K^2]
+    /*! Translational and rotational modes are fully excited, so only the
+        vibrational and electronic modes contribute, at T_v = T. */
+    libMesh::Real stat_mech_dcp_dT( unsigned int species, libMesh::Real T ) const;
+
+    //! Options for tabulated thermo and transport, from Physics/Antioch/tabulation
+    const PropertyTable::Options& tabulation_options() const;
+
+    //! Thermo model behind tabulated thermo, "stat_mech" or "cea"
+    const std::string& tabulated_thermo_model() const;
+
+    //! Whether Physics/Antioch/thermo_model is tabulated, i.e. the thermo tables are built
+    bool tabulated_thermo() const;
+
+    //! Species cp table [J/kg-K] used by TabulatedThermo
+    const PropertyTable& cp_table() const;
+
+    //! Species enthalpy table [J/kg] used by TabulatedThermo
+    const PropertyTable& h_table() const;
+
+    //! Species h/RT - s/R table used by TabulatedThermo
+    const PropertyTable& h_RT_minus_s_R_table() const;
+
+    //! ISAT cache of species source terms shared by all threads, NULL unless enabled
+    KineticsISAT* kinetics_isat() const;
+
   protected:
 
     boost::scoped_ptr<Antioch::ReactionSet<libMesh::Real> > _reaction_set;
@@ -82,6 +116,20 @@ namespace GRINS
 
     std::vector<libMesh::Real> _h_stat_mech_ref_correction;
 
+    PropertyTable::Options _tabulation_options;
+
+    std::string _tabulated_thermo_model;
+
+    bool _tabulated_thermo;
+
+    PropertyTable _cp_table;
+
+    PropertyTable _h_table;
+
+    PropertyTable _h_RT_minus_s_R_table;
+
+    boost::scoped_ptr<KineticsISAT> _kinetics_isat;
+
     void build_stat_mech_ref_correction();
 
   private:
@@ -108,6 +156,48 @@ namespace GRINS
   {
     return _h_stat_mech_ref_correction[species];
   }
+
+  inline
+  const PropertyTable::Options& AntiochMixture::tabulation_options() const
+  {
+    return _tabulation_options;
+  }
+
+  inline
+  const std::string& AntiochMixture::tabulated_thermo_model() const
+  {
+    return _tabulated_thermo_model;
+  }
+
+  inline
+  bool AntiochMixture::tabulated_thermo() const
+  {
+    return _tabulated_thermo;
+  }
+
+  inline
+  const PropertyTable& AntiochMixture::cp_table() const
+  {
+    return _cp_table;
+  }
+
+  inline
+  const PropertyTable& AntiochMixture::h_table() const
+  {
+    return _h_table;
+  }
+
+  inline
+  const PropertyTable& AntiochMixture::h_RT_minus_s_R_table() const
+  {
+    return _h_RT_minus_s_R_table;
+  }
+
+  inline
+  KineticsISAT* AntiochMixture::kinetics_isat() const
+  {
+    return _kinetics_isat.get();
+  }
   
 } // end namespace GRINS
 
@@ -33,6 +33,7 @@
 // GRINS
 #include "grins/antioch_mixture.h"
 #include "grins/property_types.h"
+#include "grins/property_table.h"
 
 // libMesh
 #include "libmesh/libmesh_common.h"
@@ -67,6 +68,10 @@ namespace GRINS
     By default, Antioch is working in SI units. Note that this documentation will always
     be built regardless if Antioch is included in the GRINS build or not. Check configure
     output to confirm that Antioch was included in the build.
+
+    If Physics/Antioch/tabulate_transport is set, species viscosities and conductivities
+    are tabulated in temperature here, once, using Physics/Antioch/tabulation options.
+    The tables are read-only and shared by all evaluators.
    */
   template<typename Thermo, typename Viscosity, typename Conductivity, typename Diffusivity>
   class AntiochWilkeTransportMixture : public AntiochMixture
@@ -85,6 +90,21 @@ namespace GRINS
 
     const Diffusivity& diffusivity() const;
 
+    //! Whether species viscosities and conductivities come from tables
+    bool tabulated_transport() const;
+
+    //! Species viscosity table [Pa-s]
+    const PropertyTable& mu_table() const;
+
+    //! Species conductivity table [W/m-K]
+    const PropertyTable& k_table() const;
+
+    //! (M_r/M_s)^(1/4), for Wilke mixing of tabulated species properties
+    libMesh::Real Mr_Ms_to_the_one_fourth( unsigned int r, unsigned int s ) const;
+
+    //! 1/sqrt(8*(1 + M_s/M_r)), for Wilke mixing of tabulated species properties
+    libMesh::Real inv_wilke_denominator( unsigned int r, unsigned int s ) const;
+
     typedef AntiochChemistry ChemistryParent;
     
   protected:
@@ -99,6 +119,20 @@ namespace GRINS
 
     boost::scoped_ptr<Diffusivity> _diffusivity;
 
+    bool _tabulate_transport;
+
+    PropertyTable _mu_table;
+
+    PropertyTable _k_table;
+
+    //! Indexed [r*n_species + s]
+    std::vector<libMesh::Real> _Mr_Ms_to_the_one_fourth;
+
+    //! Indexed [r*n_species + s]
+    std::vector<libMesh::Real> _inv_wilke_denominator;
+
+    void build_transport_tables();
+
     /* Below we will specialize the specialized_build_* functions to the appropriate type.
        This way, we can control how the cached transport objects get constructed
        based on the template type. This is achieved by the dummy types forcing operator
@@ -213,6 +247,41 @@ namespace GRINS
     return *_diffusivity.get();
   }
 
+  template<typename T, typename V, typename C, typename D>
+  inline
+  bool AntiochWilkeTransportMixture<T,V,C,D>::tabulated_transport() const
+  {
+    return _tabulate_transport;
+  }
+
+  template<typename T, typename V, typename C, typename D>
+  inline
+  const PropertyTable& AntiochWilkeTransportMixture<T,V,C,D>::mu_table() const
+  {
+    return _mu_table;
+  }
+
+  template<typename T, typename V, typename C, typename D>
+  inline
+  const PropertyTable& AntiochWilkeTransportMixture<T,V,C,D>::k_table() const
+  {
+    return _k_table;
+  }
+
+  template<typename T, typename V, typename C, typename D>
+  inline
+  libMesh::Real AntiochWilkeTransportMixture<T,V,C,D>::Mr_Ms_to_the_one_fourth( unsigned int r, unsigned int s ) const
+  {
+    return _Mr_Ms_to_the_one_fourth[r*this->n_species() + s];
+  }
+
+  template<typename T, typename V, typename C, typename D>
+  inline
+  libMesh::Real AntiochWilkeTransportMixture<T,V,C,D>::inv_wilke_denominator( unsigned int r, unsigned int s ) const
+  {
+    return _inv_wilke_denominator[r*this->n_species() + s];
+  }
+
 } // end namespace GRINS
 
 #endif // GRINS_HAVE_ANTIOCH
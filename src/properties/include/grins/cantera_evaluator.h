@@ -41,7 +41,8 @@ namespace GRINS
   //! Wrapper class for evaluating thermochemistry and transport properties using Cantera
   /*!
     This class is expected to be constructed *after* threads have been forked and will only
-    live during the lifetime of the thread. Note that this documentation will always
+    live during the lifetime of the thread. Each evaluator owns its own copy of the Cantera
+    phase, so property evaluations do not need to lock. Note that this documentation will always
     be built regardless if Cantera is included in the GRINS build or not. Check configure
     output to confirm that Cantera was included in the build if you wish to use it.
    */
@@ -100,13 +101,64 @@ namespace GRINS
                     const std::vector<libMesh::Real> mass_fractions,
                     std::vector<libMesh::Real>& omega_dot );
 
-    libMesh::Real cp( const libMesh::Real& /*T*/,
-                      const std::vector<libMesh::Real>& /*Y*/ )
+    //! Evaluate all transport, thermo, and kinetic properties over an element
+    /*! Same interface as the Antioch evaluators so that physics can be templated on
+        either. Cantera sets the full phase state per point, so this just loops over
+        the quadrature points of the cached state. omega_dot is retrieved from the
+        mixture's ISAT table, if enabled, where possible. An empty omega_dot
+        skips the kinetics. */
+    void compute_element_properties( const CachedValues& cache,
+                                     std::vector<libMesh::Real>& mu,
+                                     std::vector<libMesh::Real>& k,
+                                     std::vector<libMesh::Real>& cp,
+                                     std::vector<std::vector<libMesh::Real> >& h_s,
+                                     std::vector<std::vector<libMesh::Real> >& D_s,
+                                     std::vector<std::vector<libMesh::Real> >& omega_dot );
+
+    //! Mixture cp at temperature T; ideal gas cp does not depend on pressure
+    libMesh::Real cp( const libMesh::Real& T,
+                      const std::vector<libMesh::Real>& Y )
     {
-      libmesh_not_implemented();
-      return 0.0;
+      return _thermo.cp( T, Cantera::OneAtm, Y );
+    }
+
+    //! Species specific heats at constant pressure, [J/kg-K]
+    void cp_s( const libMesh::Real& T, std::vector<libMesh::Real>& cp_s )
+    {
+      _thermo.cp_s( T, cp_s );
+      return;
     }
 
+    //! Temperature derivatives of the species specific heats, [J/kg-K^2]
+    void dcp_s_dT( const libMesh::Real& T, std::vector<libMesh::Real>& dcp_s_dT )
+    {
+      _thermo.dcp_s_dT( T, dcp_s_dT );
+      return;
+    }
+
+    //! omega_dot and derivatives, see CanteraKinetics::omega_dot_and_derivs
+    void omega_dot_and_derivs( const libMesh::Real& T, libMesh::Real rho,
+                               const std::vector<libMesh::Real>& mass_fractions,
+                               std::vector<libMesh::Real>& omega_dot,
+                               std::vector<libMesh::Real>& domega_dot_dT,
+                               std::vector<std::vector<libMesh::Real> >& domega_dot_drho_s )
+    {
+      _kinetics.omega_dot_and_derivs( T, rho, mass_fractions, omega_dot,
+                                      domega_dot_dT, domega_dot_drho_s );
+      return;
+    }
+
+    //! omega_dot and derivatives with respect to (T, rho, Y)
+    /*! When kinetics ISAT is enabled these are the tabulated omega_dot and
+        its record gradient, consistent with the residual; see
+        KineticsISAT::omega_dot_and_derivs. */
+    void omega_dot_and_state_derivs( const libMesh::Real& T, libMesh::Real rho,
+                                     const std::vector<libMesh::Real>& mass_fractions,
+                                     std::vector<libMesh::Real>& omega_dot,
+                                     std::vector<libMesh::Real>& domega_dot_dT,
+                                     std::vector<libMesh::Real>& domega_dot_drho,
+                                     std::vector<std::vector<libMesh::Real> >& domega_dot_dY );
+
     libMesh::Real mu( const libMesh::Real& /*T*/,
                       const std::vector<libMesh::Real>& /*Y*/ )
     {
@@ -134,12 +186,22 @@ namespace GRINS
 
     CanteraMixture& _chem;
 
+    //! Phase and transport manager private to this evaluator
+    /*! These must be declared before the property wrappers below, which
+        hold references to them. */
+    boost::scoped_ptr<Cantera::IdealGasMix> _cantera_gas;
+
+    boost::scoped_ptr<Cantera::Transport> _cantera_transport;
+
     CanteraThermodynamics _thermo;
 
     CanteraTransport _transport;
 
     CanteraKinetics _kinetics;
 
+    //! ISAT work arrays for this thread, NULL unless the mixture has an ISAT table
+    boost::scoped_ptr<KineticsISAT::Workspace> _isat_workspace;
+
   private:
 
     CanteraEvaluator();
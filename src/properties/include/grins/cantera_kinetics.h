@@ -55,7 +55,12 @@ namespace GRINS
   {
   public:
 
+    //! Evaluate using the phase owned by mixture. Calls are serialized with a mutex.
     CanteraKinetics( CanteraMixture& mixture );
+
+    //! Evaluate using a phase private to the calling thread, e.g. from CanteraMixture::build_gas_clone()
+    CanteraKinetics( Cantera::IdealGasMix& gas );
+
     ~CanteraKinetics();
 
     void omega_dot( const CachedValues& cache, unsigned int qp,
@@ -69,10 +74,25 @@ namespace GRINS
                         const std::vector<libMesh::Real>& mass_fractions,
                         std::vector<libMesh::Real>& omega_dot ) const;
 
+    //! Evaluate omega_dot and its derivatives
+    /*! Same convention as AntiochKinetics::omega_dot_and_derivs: domega_dot_dT
+        is at fixed partial densities and domega_dot_drho_s[s][t] is w.r.t. the
+        partial density of species t. Cantera does not expose analytic rate
+        derivatives, so these are one-sided differences of omega_dot_TRY. That
+        is still only 1 + n_species rate evaluations per point. */
+    void omega_dot_and_derivs( const libMesh::Real& T, const libMesh::Real rho,
+                               const std::vector<libMesh::Real>& mass_fractions,
+                               std::vector<libMesh::Real>& omega_dot,
+                               std::vector<libMesh::Real>& domega_dot_dT,
+                               std::vector<std::vector<libMesh::Real> >& domega_dot_drho_s ) const;
+
   protected:
 
     Cantera::IdealGasMix& _cantera_gas;
 
+    //! Whether _cantera_gas is shared with other threads and so must be locked
+    bool _shared_phase;
+
   private:
 
     CanteraKinetics();
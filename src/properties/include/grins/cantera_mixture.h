@@ -30,6 +30,9 @@
 
 #ifdef GRINS_HAVE_CANTERA
 
+// GRINS
+#include "grins/kinetics_isat.h"
+
 // libMesh
 #include "libmesh/threads.h"
 
@@ -45,13 +48,12 @@
 // libMesh forward declarations
 class GetPot;
 
-namespace
-{
-  static libMesh::Threads::spin_mutex cantera_mutex;
-}
-
 namespace GRINS
 {
+  //! Serializes access to Cantera objects shared between threads
+  /*! Defined once in cantera_mixture.C so every translation unit locks the same mutex. */
+  extern libMesh::Threads::spin_mutex cantera_mutex;
+
   //! Wrapper class for storing state for computing thermochemistry and transport properties using Cantera
   /*!
     This class is expected to be constructed *before* threads have been forked and will
@@ -71,6 +73,17 @@ namespace GRINS
 
     Cantera::Transport& get_transport();
 
+    //! Build a new copy of the gas phase for exclusive use by one thread
+    /*! Cantera phases carry mutable state (setState_TPY), so the phase
+        returned by get_chemistry() must be locked if it is shared between
+        threads. Evaluators instead build their own copy once and use it
+        lock free. Caller takes ownership. */
+    Cantera::IdealGasMix* build_gas_clone() const;
+
+    //! Build a transport manager, of the same model as the mixture's, for gas
+    /*! Caller takes ownership. */
+    Cantera::Transport* build_transport( Cantera::IdealGasMix& gas ) const;
+
     libMesh::Real M( unsigned int species ) const;
 
     libMesh::Real M_mix( const std::vector<libMesh::Real>& mass_fractions ) const;
@@ -92,15 +105,27 @@ namespace GRINS
 
     const CanteraMixture& chemistry() const;
 
+    //! ISAT cache of species source terms shared by all threads, NULL unless enabled
+    KineticsISAT* kinetics_isat() const;
+
     //! This is basically dummy, but is needed for template games elsewhere.
     typedef CanteraMixture ChemistryParent;
 
   protected:
 
+    //! Cantera input file and phase name, needed to build clones of the phase
+    std::string _chem_file;
+    std::string _mixture_name;
+
+    //! Transport model name passed to Cantera::newTransportMgr
+    std::string _transport_model;
+
     boost::scoped_ptr<Cantera::IdealGasMix> _cantera_gas;
 
     boost::scoped_ptr<Cantera::Transport> _cantera_transport;
 
+    boost::scoped_ptr<KineticsISAT> _kinetics_isat;
+
   private:
 
     CanteraMixture();
@@ -173,6 +198,12 @@ namespace GRINS
     return *this;
   }
 
+  inline
+  KineticsISAT* CanteraMixture::kinetics_isat() const
+  {
+    return _kinetics_isat.get();
+  }
+
 } // end namespace GRINS
 
 #endif // GRINS_HAVE_CANTERA
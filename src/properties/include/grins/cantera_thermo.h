@@ -62,7 +62,12 @@ namespace GRINS
   {
   public:
 
+    //! Evaluate using the phase owned by mixture. Calls are serialized with a mutex.
     CanteraThermodynamics( CanteraMixture& mixture );
+
+    //! Evaluate using a phase private to the calling thread, e.g. from CanteraMixture::build_gas_clone()
+    CanteraThermodynamics( CanteraMixture& mixture, Cantera::IdealGasMix& gas );
+
     ~CanteraThermodynamics();
 
     libMesh::Real cp( const CachedValues& cache, unsigned int qp ) const;
@@ -75,12 +80,27 @@ namespace GRINS
 
     libMesh::Real h( const libMesh::Real& T, unsigned int species ) const;
 
+    libMesh::Real cp( const libMesh::Real& T, const libMesh::Real P,
+                      const std::vector<libMesh::Real>& Y ) const;
+
+    //! Species specific heats at constant pressure, [J/kg-K]
+    void cp_s( const libMesh::Real& T, std::vector<libMesh::Real>& cp_s ) const;
+
+    //! Temperature derivatives of the species specific heats, [J/kg-K^2]
+    /*! Cantera's species thermo managers do not expose cp derivatives, so this is
+        a central difference of cp_s. Only used by analytic Jacobians; the
+        reacting low Mach Jacobian with Cantera transport is finite differenced. */
+    void dcp_s_dT( const libMesh::Real& T, std::vector<libMesh::Real>& dcp_s_dT ) const;
+
   protected:
 
     CanteraMixture& _cantera_mixture;
 
     Cantera::IdealGasMix& _cantera_gas;
 
+    //! Whether _cantera_gas is shared with other threads and so must be locked
+    bool _shared_phase;
+
   private:
 
     CanteraThermodynamics();
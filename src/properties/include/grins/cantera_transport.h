@@ -64,7 +64,13 @@ namespace GRINS
   {
   public:
     
+    //! Evaluate using the phase owned by mixture. Calls are serialized with a mutex.
     CanteraTransport( CanteraMixture& mixture );
+
+    //! Evaluate using a phase and transport manager private to the calling thread
+    /*! transport must have been built on gas, e.g. with CanteraMixture::build_transport(). */
+    CanteraTransport( Cantera::IdealGasMix& gas, Cantera::Transport& transport );
+
     ~CanteraTransport();
 
     libMesh::Real mu( const CachedValues& cache, unsigned int qp ) const;
@@ -80,6 +86,9 @@ namespace GRINS
 
     Cantera::Transport& _cantera_transport;
 
+    //! Whether _cantera_gas is shared with other threads and so must be locked
+    bool _shared_phase;
+
   private:
 
     CanteraTransport();
@@ -0,0 +1,239 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+
+#ifndef GRINS_KINETICS_ISAT_H
+#define GRINS_KINETICS_ISAT_H
+
+// C++
+#include <iostream>
+#include <vector>
+
+// GRINS
+#include "grins/isat_table.h"
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  //! ISAT cache of species source terms as a function of the thermochemical state
+  /*!
+    Tabulates omega_dot(T, rho, Y) in an ISATTable over the scaled state
+    x = (T/T_scale, rho/rho_scale, Y_0, ..., Y_{n-1}). The record gradients
+    come from the omega_dot_and_derivs() of the kinetics backend, so Antioch
+    and Cantera are both supported through omega_dot().
+
+    Analytic Jacobians should use omega_dot_and_derivs() of this class: on a
+    retrieve it returns the record gradient, which is the exact derivative
+    of the tabulated approximation the residual sees. Exact derivatives
+    would differ from that by up to the tolerance and would cost Newton its
+    quadratic convergence.
+
+    Options are read from Physics/Chemistry/ISAT: enabled, tolerance,
+    absolute_tolerance [kg/m^3-s], max_records, max_radius, T_scale [K], and
+    rho_scale [kg/m^3].
+
+    Like the mixtures that own it, this class is expected to be constructed
+    *before* threads have been forked, and the table is shared by all threads.
+    Per-thread work arrays are kept in a Workspace owned by each evaluator.
+   */
+  class KineticsISAT
+  {
+  public:
+
+    KineticsISAT( const GetPot& input, unsigned int n_species );
+
+    ~KineticsISAT();
+
+    //! Whether Physics/Chemistry/ISAT/enabled is set
+    static bool enabled( const GetPot& input );
+
+    //! Per-thread work arrays for omega_dot()
+    struct Workspace
+    {
+      Workspace( unsigned int n_species );
+
+      std::vector<libMesh::Real> x, A, domega_dot_dT;
+
+      std::vector<std::vector<libMesh::Real> > domega_dot_drho_s;
+    };
+
+    //! Species source terms [kg/m^3-s], from the table if possible
+    /*! On a miss, omega_dot is evaluated directly by the evaluator, and
+        omega_dot_and_derivs() is only called when a new record is added. */
+    template<typename Evaluator>
+    void omega_dot( Evaluator& evaluator, libMesh::Real T, libMesh::Real rho,
+                    const std::vector<libMesh::Real>& Y,
+                    std::vector<libMesh::Real>& omega_dot,
+                    Workspace& workspace );
+
+    //! omega_dot and its derivatives with respect to the state (T, rho, Y)
+    /*! domega_dot_dT is at fixed rho and Y, domega_dot_drho at fixed Y and
+        domega_dot_dY[s][t] at fixed T and rho. On a retrieve these are the
+        gradient of the tabulated approximation returned as omega_dot. On a
+        miss everything is evaluated directly and offered to the table, as
+        in omega_dot(). */
+    template<typename Evaluator>
+    void omega_dot_and_derivs( Evaluator& evaluator, libMesh::Real T, libMesh::Real rho,
+                               const std::vector<libMesh::Real>& Y,
+                               std::vector<libMesh::Real>& omega_dot,
+                               std::vector<libMesh::Real>& domega_dot_dT,
+                               std::vector<libMesh::Real>& domega_dot_drho,
+                               std::vector<std::vector<libMesh::Real> >& domega_dot_dY,
+                               Workspace& workspace );
+
+    //! Convert derivatives at fixed partial densities rho_t = rho*Y_t to the state (T, rho, Y)
+    /*! On input domega_dot_dY holds the backend's domega_dot_drho_s. The
+        temperature derivative is the same in both. */
+    static void state_derivatives( libMesh::Real rho, const std::vector<libMesh::Real>& Y,
+                                   std::vector<libMesh::Real>& domega_dot_drho,
+                                   std::vector<std::vector<libMesh::Real> >& domega_dot_dY );
+
+    //! Table counts, see ISATTable::statistics()
+    void statistics( std::vector<unsigned long>& counts ) const;
+
+    //! Print counts given by statistics(), e.g. after summing across processors
+    void print_statistics( const std::vector<unsigned long>& counts, std::ostream& out ) const;
+
+  protected:
+
+    //! Fill workspace.A with the gradient of omega_dot with respect to the scaled state
+    void build_gradient( libMesh::Real rho, const std::vector<libMesh::Real>& Y,
+                         Workspace& workspace ) const;
+
+    unsigned int _n_species;
+
+    libMesh::Real _T_scale;
+
+    libMesh::Real _rho_scale;
+
+    ISATTable _table;
+
+  private:
+
+    KineticsISAT();
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+  template<typename Evaluator>
+  inline
+  void KineticsISAT::omega_dot( Evaluator& evaluator, libMesh::Real T, libMesh::Real rho,
+                                const std::vector<libMesh::Real>& Y,
+                                std::vector<libMesh::Real>& omega_dot,
+                                Workspace& workspace )
+  {
+    libmesh_assert_equal_to( Y.size(), _n_species );
+
+    std::vector<libMesh::Real>& x = workspace.x;
+
+    x[0] = T/_T_scale;
+    x[1] = rho/_rho_scale;
+    for( unsigned int s = 0; s < _n_species; s++ )
+      x[s+2] = Y[s];
+
+    if( _table.retrieve( x, omega_dot ) )
+      return;
+
+    evaluator.omega_dot( T, rho, Y, omega_dot );
+
+    if( _table.grow( x, omega_dot ) || _table.full() )
+      return;
+
+    evaluator.omega_dot_and_derivs( T, rho, Y, omega_dot,
+                                    workspace.domega_dot_dT,
+                                    workspace.domega_dot_drho_s );
+
+    this->build_gradient( rho, Y, workspace );
+
+    _table.add( x, omega_dot, workspace.A );
+
+    return;
+  }
+
+  template<typename Evaluator>
+  inline
+  void KineticsISAT::omega_dot_and_derivs( Evaluator& evaluator, libMesh::Real T, libMesh::Real rho,
+                                           const std::vector<libMesh::Real>& Y,
+                                           std::vector<libMesh::Real>& omega_dot,
+                                           std::vector<libMesh::Real>& domega_dot_dT,
+                                           std::vector<libMesh::Real>& domega_dot_drho,
+                                           std::vector<std::vector<libMesh::Real> >& domega_dot_dY,
+                                           Workspace& workspace )
+  {
+    libmesh_assert_equal_to( Y.size(), _n_species );
+
+    std::vector<libMesh::Real>& x = workspace.x;
+
+    x[0] = T/_T_scale;
+    x[1] = rho/_rho_scale;
+    for( unsigned int s = 0; s < _n_species; s++ )
+      x[s+2] = Y[s];
+
+    if( _table.retrieve( x, omega_dot, workspace.A ) )
+      {
+        const unsigned int n_inputs = _n_species+2;
+
+        // Undo the scaling of build_gradient()
+        for( unsigned int s = 0; s < _n_species; s++ )
+          {
+            const libMesh::Real* A_s = &workspace.A[s*n_inputs];
+
+            domega_dot_dT[s] = A_s[0]/_T_scale;
+            domega_dot_drho[s] = A_s[1]/_rho_scale;
+
+            for( unsigned int t = 0; t < _n_species; t++ )
+              domega_dot_dY[s][t] = A_s[t+2];
+          }
+
+        return;
+      }
+
+    evaluator.omega_dot_and_derivs( T, rho, Y, omega_dot,
+                                    workspace.domega_dot_dT,
+                                    workspace.domega_dot_drho_s );
+
+    if( !_table.grow( x, omega_dot ) && !_table.full() )
+      {
+        this->build_gradient( rho, Y, workspace );
+
+        _table.add( x, omega_dot, workspace.A );
+      }
+
+    domega_dot_dT = workspace.domega_dot_dT;
+    domega_dot_dY = workspace.domega_dot_drho_s;
+
+    state_derivatives( rho, Y, domega_dot_drho, domega_dot_dY );
+
+    return;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_KINETICS_ISAT_H
@@ -0,0 +1,295 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_PROPERTY_TABLE_H
+#define GRINS_PROPERTY_TABLE_H
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  //! Interface for the functions of temperature tabulated by PropertyTable
+  class PropertyTableFunction
+  {
+  public:
+
+    virtual ~PropertyTableFunction(){};
+
+    //! Exact value of function i at temperature T
+    virtual libMesh::Real operator()( unsigned int i, libMesh::Real T ) const =0;
+
+  };
+
+  //! Piecewise cubic Hermite tables for a set of functions of temperature
+  /*!
+    All functions share one grid, uniform in either T or ln(T), so that locating
+    a temperature costs one multiply and one truncation regardless of how many
+    functions are stored. Values and nodal slopes are stored node-major, so the
+    whole set of functions at one temperature is read from two contiguous blocks.
+
+    The grid is refined at build time, doubling the number of intervals until the
+    interpolation error at every interval midpoint, relative to the largest
+    tabulated magnitude of that function, is below the requested tolerance.
+
+    The table is read-only once built and may be shared between threads.
+   */
+  class PropertyTable
+  {
+  public:
+
+    enum GridSpacing { UNIFORM = 0,
+                       LOG };
+
+    enum Interpolation { CUBIC = 0,
+                         MONOTONE_CUBIC };
+
+    //! Parameters controlling how a PropertyTable is built
+    struct Options
+    {
+      Options();
+
+      //! Parse options from input, e.g. section = "Physics/Antioch/tabulation"
+      void read_input_options( const GetPot& input, const std::string& section );
+
+      libMesh::Real T_min;
+
+      libMesh::Real T_max;
+
+      //! Starting number of grid points
+      unsigned int n_points;
+
+      //! Refinement stops with an error if more points than this are needed
+      unsigned int max_points;
+
+      //! Relative interpolation error tolerance
+      libMesh::Real tolerance;
+
+      GridSpacing spacing;
+
+      Interpolation interpolation;
+    };
+
+    PropertyTable();
+
+    ~PropertyTable();
+
+    //! Tabulate n_functions functions of temperature
+    /*! Errors out if the tolerance cannot be met with options.max_points points. */
+    void build( const PropertyTableFunction& f, unsigned int n_functions,
+                const Options& options );
+
+    //! Whether T lies inside the tabulated range
+    bool in_range( libMesh::Real T ) const;
+
+    //! Interpolated value of function i at T. T must be in range.
+    libMesh::Real operator()( unsigned int i, libMesh::Real T ) const;
+
+    //! Interpolated values of all functions at T. T must be in range.
+    void operator()( libMesh::Real T, std::vector<libMesh::Real>& f ) const;
+
+    //! Temperature derivatives of the interpolants of all functions at T. T must be in range.
+    void derivative( libMesh::Real T, std::vector<libMesh::Real>& df_dT ) const;
+
+    unsigned int n_functions() const;
+
+    unsigned int n_points() const;
+
+    //! Largest relative midpoint error measured at build time
+    libMesh::Real max_error() const;
+
+  protected:
+
+    //! Fill values and slopes on a grid with n_points points
+    void tabulate( const PropertyTableFunction& f, unsigned int n_points );
+
+    //! Hermite slopes, scaled by the grid spacing
+    void compute_slopes();
+
+    //! Largest relative error at interval midpoints
+    libMesh::Real midpoint_error( const PropertyTableFunction& f ) const;
+
+    //! Interval index and local coordinate in [0,1] for temperature T
+    void locate( libMesh::Real T, unsigned int& interval, libMesh::Real& t ) const;
+
+    //! Temperature at grid coordinate x
+    libMesh::Real temperature( libMesh::Real x ) const;
+
+    unsigned int _n_functions;
+
+    unsigned int _n_points;
+
+    Options _options;
+
+    //! Grid coordinate (T or ln(T)) at the first node
+    libMesh::Real _x_min;
+
+    libMesh::Real _dx;
+
+    libMesh::Real _inv_dx;
+
+    libMesh::Real _max_error;
+
+    //! _values[node*_n_functions + i]
+    std::vector<libMesh::Real> _values;
+
+    //! Slopes with respect to the grid coordinate, times _dx, same layout as _values
+    std::vector<libMesh::Real> _slopes;
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+  inline
+  bool PropertyTable::in_range( libMesh::Real T ) const
+  {
+    return (T >= _options.T_min) && (T <= _options.T_max);
+  }
+
+  inline
+  unsigned int PropertyTable::n_functions() const
+  {
+    return _n_functions;
+  }
+
+  inline
+  unsigned int PropertyTable::n_points() const
+  {
+    return _n_points;
+  }
+
+  inline
+  libMesh::Real PropertyTable::max_error() const
+  {
+    return _max_error;
+  }
+
+  inline
+  void PropertyTable::locate( libMesh::Real T, unsigned int& interval, libMesh::Real& t ) const
+  {
+    libmesh_assert( this->in_range(T) );
+
+    const libMesh::Real x = (_options.spacing == LOG) ? std::log(T) : T;
+
+    const libMesh::Real s = (x - _x_min)*_inv_dx;
+
+    // Guard the upper end point and round-off in log(T_max)
+    interval = std::min( static_cast<unsigned int>( std::max( s, 0.0 ) ), _n_points-2 );
+
+    t = s - interval;
+
+    return;
+  }
+
+  inline
+  libMesh::Real PropertyTable::operator()( unsigned int i, libMesh::Real T ) const
+  {
+    libmesh_assert_less( i, _n_functions );
+
+    unsigned int interval;
+    libMesh::Real t;
+    this->locate( T, interval, t );
+
+    const unsigned int a = interval*_n_functions + i;
+    const unsigned int b = a + _n_functions;
+
+    const libMesh::Real t2 = t*t;
+    const libMesh::Real t3 = t2*t;
+
+    return (2.0*t3 - 3.0*t2 + 1.0)*_values[a] + (t3 - 2.0*t2 + t)*_slopes[a]
+      + (3.0*t2 - 2.0*t3)*_values[b] + (t3 - t2)*_slopes[b];
+  }
+
+  inline
+  void PropertyTable::operator()( libMesh::Real T, std::vector<libMesh::Real>& f ) const
+  {
+    libmesh_assert_equal_to( f.size(), _n_functions );
+
+    unsigned int interval;
+    libMesh::Real t;
+    this->locate( T, interval, t );
+
+    const libMesh::Real t2 = t*t;
+    const libMesh::Real t3 = t2*t;
+
+    const libMesh::Real h00 = 2.0*t3 - 3.0*t2 + 1.0;
+    const libMesh::Real h10 = t3 - 2.0*t2 + t;
+    const libMesh::Real h01 = 3.0*t2 - 2.0*t3;
+    const libMesh::Real h11 = t3 - t2;
+
+    const unsigned int a = interval*_n_functions;
+    const unsigned int b = a + _n_functions;
+
+    for( unsigned int i = 0; i < _n_functions; i++ )
+      {
+        f[i] = h00*_values[a+i] + h10*_slopes[a+i] + h01*_values[b+i] + h11*_slopes[b+i];
+      }
+
+    return;
+  }
+
+  inline
+  void PropertyTable::derivative( libMesh::Real T, std::vector<libMesh::Real>& df_dT ) const
+  {
+    libmesh_assert_equal_to( df_dT.size(), _n_functions );
+
+    unsigned int interval;
+    libMesh::Real t;
+    this->locate( T, interval, t );
+
+    const libMesh::Real t2 = t*t;
+
+    // dt/dT, through the grid coordinate
+    libMesh::Real dt_dT = _inv_dx;
+    if( _options.spacing == LOG )
+      dt_dT /= T;
+
+    const libMesh::Real dh00 = (6.0*t2 - 6.0*t)*dt_dT;
+    const libMesh::Real dh10 = (3.0*t2 - 4.0*t + 1.0)*dt_dT;
+    const libMesh::Real dh01 = (6.0*t - 6.0*t2)*dt_dT;
+    const libMesh::Real dh11 = (3.0*t2 - 2.0*t)*dt_dT;
+
+    const unsigned int a = interval*_n_functions;
+    const unsigned int b = a + _n_functions;
+
+    for( unsigned int i = 0; i < _n_functions; i++ )
+      {
+        df_dT[i] = dh00*_values[a+i] + dh10*_slopes[a+i] + dh01*_values[b+i] + dh11*_slopes[b+i];
+      }
+
+    return;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_PROPERTY_TABLE_H
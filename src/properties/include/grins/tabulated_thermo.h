@@ -0,0 +1,168 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+
+#ifndef GRINS_TABULATED_THERMO_H
+#define GRINS_TABULATED_THERMO_H
+
+#include "grins_config.h"
+
+#ifdef GRINS_HAVE_ANTIOCH
+
+// GRINS
+#include "grins/property_table.h"
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// Antioch
+#include "antioch/cea_evaluator.h"
+#include "antioch/stat_mech_thermo.h"
+
+// Boost
+#include <boost/scoped_ptr.hpp>
+
+namespace GRINS
+{
+  // GRINS forward declarations
+  class AntiochMixture;
+
+  //! Table driven thermodynamics for use as the Thermo type of AntiochEvaluator
+  /*!
+    Species cp, species enthalpy, and the h/RT - s/R needed by the equilibrium
+    constants are looked up in temperature tables, built from the underlying thermo
+    model (CEA or statistical mechanics) with the PropertyTable options held by the
+    AntiochMixture. Lookups replace the NASA polynomial or vibrational/electronic
+    mode evaluations with a single interval search and a cubic Hermite evaluation
+    per species. Outside the tabulated range the exact model is evaluated instead.
+
+    The tables are built once by the AntiochMixture, which must have been constructed
+    with Physics/Antioch/thermo_model = tabulated, and each pooled evaluator's
+    TabulatedThermo only holds const references to them.
+    Tables are in SI units: cp_s [J/kg-K], h_s [J/kg].
+   */
+  class TabulatedThermo
+  {
+  public:
+
+    TabulatedThermo( const AntiochMixture& mixture );
+
+    ~TabulatedThermo();
+
+    //! Mixture specific heat at constant pressure [J/kg-K]
+    libMesh::Real cp( libMesh::Real T, const std::vector<libMesh::Real>& Y ) const;
+
+    //! Mixture specific heat at constant volume [J/kg-K]
+    libMesh::Real cv( libMesh::Real T, const std::vector<libMesh::Real>& Y ) const;
+
+    //! Species specific heats at constant pressure [J/kg-K]
+    void cp( libMesh::Real T, std::vector<libMesh::Real>& cp_s ) const;
+
+    //! Temperature derivatives of the species cp [J/kg-K^2], consistent with cp()
+    void dcp_dT( libMesh::Real T, std::vector<libMesh::Real>& dcp_s_dT ) const;
+
+    //! Species enthalpy [J/kg]
+    libMesh::Real h( unsigned int species, libMesh::Real T ) const;
+
+    //! Species enthalpies [J/kg]
+    void h( libMesh::Real T, std::vector<libMesh::Real>& h_s ) const;
+
+    //! h/RT - s/R for each species, from the CEA fits as in AntiochKinetics
+    void h_RT_minus_s_R( libMesh::Real T, std::vector<libMesh::Real>& h_RT_minus_s_R ) const;
+
+    //! Exact species cp [J/kg-K] from the underlying thermo model
+    libMesh::Real exact_cp( unsigned int species, libMesh::Real T ) const;
+
+    //! Exact species cp temperature derivative [J/kg-K^2] from the underlying thermo model
+    libMesh::Real exact_dcp_dT( unsigned int species, libMesh::Real T ) const;
+
+    //! Exact species enthalpy [J/kg] from the underlying thermo model
+    libMesh::Real exact_h( unsigned int species, libMesh::Real T ) const;
+
+    //! Exact h/RT - s/R from the CEA fits
+    libMesh::Real exact_h_RT_minus_s_R( unsigned int species, libMesh::Real T ) const;
+
+    //! Tabulate the exact cp, h and h/RT - s/R; used by AntiochMixture to build its tables
+    void build_tables( PropertyTable& cp_table,
+                       PropertyTable& h_table,
+                       PropertyTable& h_RT_minus_s_R_table ) const;
+
+    const PropertyTable& cp_table() const;
+
+    const PropertyTable& h_table() const;
+
+    const PropertyTable& h_RT_minus_s_R_table() const;
+
+  protected:
+
+    const AntiochMixture& _chem;
+
+    //! Whether tables come from statistical mechanics rather than CEA fits
+    bool _use_stat_mech;
+
+    boost::scoped_ptr<Antioch::CEAEvaluator<libMesh::Real> > _cea_thermo;
+
+    boost::scoped_ptr<Antioch::StatMechThermodynamics<libMesh::Real> > _stat_mech_thermo;
+
+    //! Owned by the AntiochMixture
+    const PropertyTable& _cp_table;
+
+    const PropertyTable& _h_table;
+
+    const PropertyTable& _h_RT_minus_s_R_table;
+
+    //! Work array for the mixture cp and cv
+    mutable std::vector<libMesh::Real> _cp_s;
+
+  private:
+
+    TabulatedThermo();
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+  inline
+  const PropertyTable& TabulatedThermo::cp_table() const
+  {
+    return _cp_table;
+  }
+
+  inline
+  const PropertyTable& TabulatedThermo::h_table() const
+  {
+    return _h_table;
+  }
+
+  inline
+  const PropertyTable& TabulatedThermo::h_RT_minus_s_R_table() const
+  {
+    return _h_RT_minus_s_R_table;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_HAVE_ANTIOCH
+
+#endif // GRINS_TABULATED_THERMO_H
@@ -0,0 +1,169 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_BDF2_TIME_SOLVER_H
+#define GRINS_BDF2_TIME_SOLVER_H
+
+// C++
+#include <vector>
+
+// libMesh
+#include "libmesh/auto_ptr.h"
+#include "libmesh/numeric_vector.h"
+#include "libmesh/system_norm.h"
+#include "libmesh/unsteady_solver.h"
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+
+  //! Variable step BDF2 with a predictor-corrector error estimate
+  /*!
+    With \f$ \omega = \Delta t_n/\Delta t_{n-1} \f$ the rate handed to the
+    mass residual is
+
+    \f$ \dot{u}_{n+1} = \frac{1}{\Delta t_n} \left( \frac{1+2\omega}{1+\omega} u_{n+1}
+        - (1+\omega) u_n + \frac{\omega^2}{1+\omega} u_{n-1} \right) \f$
+
+    and all other terms are evaluated at \f$ u_{n+1} \f$. The first step is
+    backward Euler.
+
+    Once three solutions are stored, each step starts Newton from the
+    quadratic extrapolation of \f$ u_n, u_{n-1}, u_{n-2} \f$, and the
+    difference to the converged solution, scaled by the ratio of the
+    error constants, estimates the local error. The estimate costs one
+    vector norm per step instead of the extra solves of step doubling.
+    Relative to the norm of the solution, both measured in component_norm,
+    it drives a PI step size controller toward target_tolerance. Steps with
+    an error above upper_tolerance are rejected and repeated with a smaller
+    deltat. Without a target_tolerance deltat is left alone.
+
+    A nonlinear solve that does not converge halves deltat, at most
+    reduce_deltat_on_diffsolver_failure times, after which solve() errors
+    out rather than accept the step. ESDIRKTimeSolver is the one step
+    alternative. Adjoint time stepping is not supported.
+   */
+  class BDF2TimeSolver : public libMesh::UnsteadySolver
+  {
+  public:
+
+    BDF2TimeSolver( MultiphysicsSystem& system );
+    virtual ~BDF2TimeSolver();
+
+    //! Adds the vectors of the older solutions to the system
+    virtual void init();
+
+    virtual void init_data();
+
+    virtual void reinit();
+
+    //! Solves the current timestep, repeating it while the error is too large
+    /*! Errors out when the nonlinear solve still fails after
+        reduce_deltat_on_diffsolver_failure halvings of deltat. */
+    virtual void solve();
+
+    //! Shifts the solution history and advances time by the last accepted deltat
+    virtual void advance_timestep();
+
+    //! Step size history, for checkpointing
+    void get_history( std::vector<libMesh::Real>& history ) const;
+
+    //! Restores a history from get_history(), once the solution vectors are restored
+    void set_history( const std::vector<libMesh::Real>& history );
+
+    virtual libMesh::Real error_order() const;
+
+    virtual unsigned int time_order() const;
+
+    virtual bool element_residual( bool request_jacobian,
+                                   libMesh::DiffContext& context );
+
+    virtual bool side_residual( bool request_jacobian,
+                                libMesh::DiffContext& context );
+
+    virtual bool nonlocal_residual( bool request_jacobian,
+                                    libMesh::DiffContext& context );
+
+    //! Relative local error the step size controller aims for, 0 for fixed steps
+    libMesh::Real target_tolerance;
+
+    //! Steps with a larger relative local error are repeated, 0 to accept all
+    libMesh::Real upper_tolerance;
+
+    //! Largest ratio of successive timesteps, 0 for no limit
+    libMesh::Real max_growth;
+
+    //! Norm in which the local error and the solution are measured
+    libMesh::SystemNorm component_norm;
+
+  protected:
+
+    typedef bool (MultiphysicsSystem::*ResidualFunction)( bool, libMesh::DiffContext& );
+
+    typedef void (libMesh::DiffContext::*ReinitFunction)( libMesh::Real );
+
+    //! BDF2 rate, evaluated at the current solution, plus the other terms
+    /*! mass may be NULL when there is no mass term. reinit sets the context
+        time to t_{n+1}, as EulerSolver does for t_theta. */
+    bool general_residual( bool request_jacobian,
+                           libMesh::DiffContext& context,
+                           ResidualFunction mass,
+                           ResidualFunction time_derivative,
+                           ResidualFunction constraint,
+                           ReinitFunction reinit );
+
+    //! Coefficients of u_{n+1}, u_n and u_{n-1} in the rate
+    void rate_coefficients( libMesh::Real& a0, libMesh::Real& a1, libMesh::Real& a2 ) const;
+
+    //! Quadratic extrapolation of the stored solutions to the new time
+    void predict( libMesh::NumericVector<libMesh::Number>& predictor ) const;
+
+    //! Ratio of the corrector error to the corrector-predictor difference
+    libMesh::Real error_factor() const;
+
+    MultiphysicsSystem& _multiphysics_system;
+
+    //! u_{n-1} on the local and ghost dofs
+    libMesh::AutoPtr<libMesh::NumericVector<libMesh::Number> > _older_local_nonlinear_solution;
+
+    //! Number of stored solutions, at most 3
+    unsigned int _n_history;
+
+    //! deltat of the last accepted step
+    libMesh::Real _last_deltat;
+
+    //! t_n - t_{n-1} and t_{n-1} - t_{n-2}
+    libMesh::Real _old_deltat;
+    libMesh::Real _older_deltat;
+
+    //! Error of the last accepted step, relative to target_tolerance
+    libMesh::Real _previous_error;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_BDF2_TIME_SOLVER_H
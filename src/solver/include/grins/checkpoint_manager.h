@@ -0,0 +1,171 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_CHECKPOINT_MANAGER_H
+#define GRINS_CHECKPOINT_MANAGER_H
+
+// C++
+#include <deque>
+#include <string>
+#include <vector>
+#include "boost/tr1/memory.hpp"
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/parallel.h"
+#include "libmesh/threads.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+
+  //! Periodic, rotating checkpoints of a transient solve and restart from them
+  /*!
+    Every restart-options/timesteps_per_checkpoint timesteps the solution,
+    all vectors added to the system (the old solutions kept by the time
+    solver among them), the time, deltat and the time solver history are
+    saved to restart-options/checkpoint_prefix.<slot>.chk. The last
+    restart-options/n_checkpoints snapshots are kept, the slots being
+    reused in turn. The mesh, including its refinement hierarchy, is only
+    written when it changed since the previous checkpoint, to
+    checkpoint_prefix.mesh.<n>.xdr, and is referenced by the snapshots.
+
+    The vectors are gathered on processor 0 while the timestep loop waits;
+    the file is then written by a background thread while time stepping
+    continues. It is written under a temporary name and renamed when done,
+    so a slot file is always a complete snapshot. Values are stored by the
+    position of their node, or the level and centroid of their element, so
+    a restart does not depend on the partitioning or the number of
+    processors. This requires a serial mesh, and it is an error for two
+    nodes to coincide, as duplicated interface nodes would.
+
+    With restart-options/restart_from_checkpoint the mesh and solution of
+    the newest complete snapshot replace the ones built from input and
+    time stepping continues from its timestep. If there is no snapshot
+    yet, the run starts from the initial conditions, so a job can always
+    be (re)submitted with this option.
+   */
+  class CheckpointManager
+  {
+  public:
+
+    CheckpointManager( const GetPot& input, const libMesh::Parallel::Communicator& comm );
+
+    //! Waits for the last write to finish
+    ~CheckpointManager();
+
+    //! Whether the input asks for checkpoints or a restart from one
+    static bool is_enabled( const GetPot& input );
+
+    //! Mesh file of the newest complete checkpoint, empty if there is none or no restart was asked for
+    static std::string restart_mesh_file( const GetPot& input, const libMesh::Parallel::Communicator& comm );
+
+    //! Restore the newest complete checkpoint into system, if restarting
+    /*! Must be called once the system, including its time solver, is initialized. */
+    void restore( MultiphysicsSystem& system );
+
+    //! Timestep the restored checkpoint was taken after, 0 if not restarted
+    unsigned int restart_timestep() const
+    { return _restart_timestep; }
+
+    //! Whether restore() loaded a checkpoint
+    bool restarted() const
+    { return _restarted; }
+
+    //! The mesh was refined or coarsened, so the next checkpoint writes it again
+    void mesh_changed()
+    { _mesh_changed = true; }
+
+    //! Checkpoint if n_timesteps, the number of completed timesteps, is a checkpoint timestep
+    void end_timestep( MultiphysicsSystem& system, unsigned int n_timesteps );
+
+    //! Waits for the background write, if any, to finish
+    void finish();
+
+  protected:
+
+    //! One snapshot on disk
+    struct Snapshot
+    {
+      unsigned int sequence;
+      unsigned int timestep;
+      std::string data_file;
+      std::string mesh_file;
+    };
+
+    //! Gather system on processor 0 and start writing it in the background
+    void write( MultiphysicsSystem& system, unsigned int n_timesteps );
+
+    //! Snapshots found on disk, oldest first
+    static void find_snapshots( const std::string& prefix, unsigned int n_checkpoints,
+                                const libMesh::Parallel::Communicator& comm,
+                                std::vector<Snapshot>& snapshots );
+
+    static std::string data_filename( const std::string& prefix, unsigned int slot );
+
+    const libMesh::Parallel::Communicator& _comm;
+
+    unsigned int _timesteps_per_checkpoint;
+
+    unsigned int _n_checkpoints;
+
+    std::string _prefix;
+
+    bool _restart_from_checkpoint;
+
+    bool _restarted;
+
+    unsigned int _restart_timestep;
+
+    //! Number of checkpoints taken, over restarts
+    unsigned int _n_written;
+
+    bool _mesh_changed;
+
+    //! Mesh file of the current mesh, once written
+    std::string _mesh_file;
+
+    //! Snapshots on disk, oldest first, at most _n_checkpoints
+    std::deque<Snapshot> _snapshots;
+
+    //! Writes the last checkpoint on processor 0, NULL when idle
+    libMesh::Threads::Thread* _writer;
+
+    //! Set by the writer if it could not write the checkpoint
+    std::tr1::shared_ptr<bool> _write_failed;
+
+  private:
+
+    CheckpointManager();
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_CHECKPOINT_MANAGER_H
@@ -0,0 +1,177 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_ESDIRK_TIME_SOLVER_H
+#define GRINS_ESDIRK_TIME_SOLVER_H
+
+// C++
+#include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/auto_ptr.h"
+#include "libmesh/numeric_vector.h"
+#include "libmesh/system_norm.h"
+#include "libmesh/unsteady_solver.h"
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+
+  //! TR-BDF2 as an ESDIRK with an embedded third order error estimate
+  /*!
+    The stiffly accurate, L-stable ESDIRK of Hosea and Shampine (1996),
+    with \f$ \gamma = 2 - \sqrt{2} \f$, \f$ d = \gamma/2 \f$ and
+    \f$ w = \sqrt{2}/4 \f$:
+
+    \f$ c = (0, \gamma, 1), \quad
+        A = \left( \begin{array}{ccc} 0 & & \\ d & d & \\ w & w & d \end{array} \right), \quad
+        b = (w, w, d), \quad
+        \hat{b} = \left( \frac{1-w}{3}, \frac{3w+1}{3}, \frac{d}{3} \right) \f$
+
+    Each implicit stage \f$ i \f$ solves \f$ M K_i = F(U_i) \f$ for
+    \f$ U_i = Y_i + h a_{ii} K_i \f$, where the stage base
+    \f$ Y_i = u_n + h \sum_{j<i} a_{ij} K_j \f$ is assembled from the
+    stored stage derivatives. The mass residual therefore sees the rate
+    \f$ (U_i - Y_i)/(h a_{ii}) \f$, and after the solve \f$ K_i \f$ is
+    recovered from the same expression, without a mass matrix solve.
+    The explicit first stage reuses the derivative of the last stage of
+    the previous step, so each step costs two nonlinear solves. The very
+    first step is backward Euler, without an error estimate, and provides
+    that derivative.
+
+    \f$ h \sum_i (b_i - \hat{b}_i) K_i \f$ estimates the local error. As for
+    BDF2TimeSolver, relative to the norm of the solution, both measured in
+    component_norm, it drives a PI step size controller toward
+    target_tolerance, and steps with an error above upper_tolerance are
+    repeated with a smaller deltat. A nonlinear solve that does not
+    converge halves deltat, at most reduce_deltat_on_diffsolver_failure
+    times, after which solve() errors out. Adjoint time stepping is not
+    supported.
+   */
+  class ESDIRKTimeSolver : public libMesh::UnsteadySolver
+  {
+  public:
+
+    ESDIRKTimeSolver( MultiphysicsSystem& system );
+    virtual ~ESDIRKTimeSolver();
+
+    //! Adds the stage vectors to the system
+    virtual void init();
+
+    virtual void init_data();
+
+    virtual void reinit();
+
+    //! Solves the stages of the current timestep, repeating it while the error is too large
+    /*! Errors out when a stage solve still fails after
+        reduce_deltat_on_diffsolver_failure halvings of deltat. */
+    virtual void solve();
+
+    //! Keeps the last stage derivative and advances time by the last accepted deltat
+    virtual void advance_timestep();
+
+    //! Step size history, for checkpointing
+    void get_history( std::vector<libMesh::Real>& history ) const;
+
+    //! Restores a history from get_history(), once the solution vectors are restored
+    void set_history( const std::vector<libMesh::Real>& history );
+
+    virtual libMesh::Real error_order() const;
+
+    virtual unsigned int time_order() const;
+
+    virtual bool element_residual( bool request_jacobian,
+                                   libMesh::DiffContext& context );
+
+    virtual bool side_residual( bool request_jacobian,
+                                libMesh::DiffContext& context );
+
+    virtual bool nonlocal_residual( bool request_jacobian,
+                                    libMesh::DiffContext& context );
+
+    //! Relative local error the step size controller aims for, 0 for fixed steps
+    libMesh::Real target_tolerance;
+
+    //! Steps with a larger relative local error are repeated, 0 to accept all
+    libMesh::Real upper_tolerance;
+
+    //! Largest ratio of successive timesteps, 0 for no limit
+    libMesh::Real max_growth;
+
+    //! Norm in which the local error and the solution are measured
+    libMesh::SystemNorm component_norm;
+
+  protected:
+
+    typedef bool (MultiphysicsSystem::*ResidualFunction)( bool, libMesh::DiffContext& );
+
+    typedef void (libMesh::DiffContext::*ReinitFunction)( libMesh::Real );
+
+    //! Stage rate, evaluated at the current solution, plus the other terms
+    /*! mass may be NULL when there is no mass term. reinit sets the context
+        time to t_n + c_i h. */
+    bool general_residual( bool request_jacobian,
+                           libMesh::DiffContext& context,
+                           ResidualFunction mass,
+                           ResidualFunction time_derivative,
+                           ResidualFunction constraint,
+                           ReinitFunction reinit );
+
+    //! a_{ii} and c_i of the current stage, 1 and 1 for the backward Euler step
+    void stage_coefficients( libMesh::Real& diagonal, libMesh::Real& c ) const;
+
+    //! Name of the vector holding K_i
+    static std::string stage_derivative_name( unsigned int stage );
+
+    //! Solves the current stage from the stage base, returns false if it did not converge
+    bool solve_stage();
+
+    MultiphysicsSystem& _multiphysics_system;
+
+    //! Y_i on the local and ghost dofs
+    libMesh::AutoPtr<libMesh::NumericVector<libMesh::Number> > _stage_base_local;
+
+    //! Current implicit stage, 1 or 2
+    unsigned int _stage;
+
+    //! Whether the current step is the starting backward Euler step
+    bool _backward_euler;
+
+    //! Whether K_0, the derivative at t_n, is known
+    bool _have_derivative;
+
+    //! deltat of the last accepted step
+    libMesh::Real _last_deltat;
+
+    //! Error of the last accepted step, relative to target_tolerance
+    libMesh::Real _previous_error;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_ESDIRK_TIME_SOLVER_H
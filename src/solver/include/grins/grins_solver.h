@@ -27,6 +27,7 @@
 #define GRINS_SOLVER_H
 
 // C++
+#include <iostream>
 #include "boost/tr1/memory.hpp"
 
 // GRINS
@@ -83,6 +84,10 @@ namespace GRINS
       const
     { libmesh_not_implemented(); }
 
+    //! Print Jacobian assembly/reuse counts of the GRINS Newton solvers
+    /*! Prints nothing when the libMesh NewtonSolver is in use. */
+    void print_solver_statistics( MultiphysicsSystem& system, std::ostream& out ) const;
+
     //! Do steady version of adjoint solve
     /*! We put this here since we may want to reuse this
         in multiple different steady solves. */
@@ -107,6 +112,16 @@ namespace GRINS
     bool _continue_after_backtrack_failure;
     bool _continue_after_max_iterations;
 
+    // Options of the GRINS Newton solvers, see NewtonSolverBase
+    unsigned int _max_backtracks;
+    double _jacobian_free_epsilon;
+
+    // Jacobian reuse options, see JacobianReusePolicy
+    unsigned int _jacobian_reuse_iterations;
+    unsigned int _jacobian_reuse_timesteps;
+    double _jacobian_reuse_rate;
+    double _jacobian_reuse_dt_tolerance;
+
     // Screen display options
     bool _solver_quiet;
     bool _solver_verbose;    
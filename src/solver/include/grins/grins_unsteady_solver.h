@@ -26,6 +26,9 @@
 #ifndef GRINS_UNSTEADY_SOLVER_H
 #define GRINS_UNSTEADY_SOLVER_H
 
+// C++
+#include <string>
+
 //GRINS
 #include "grins/grins_solver.h"
 
@@ -47,6 +50,13 @@ namespace GRINS
 
     virtual void init_time_solver(GRINS::MultiphysicsSystem* system);
 
+    //! Called at the end of each timestep, once the time solver has advanced
+    /*! Default is to do nothing. */
+    virtual void end_timestep( SolverContext& context, unsigned int t_step );
+
+    //! Time integrator, "theta" (libMesh::EulerSolver), "bdf2" (BDF2TimeSolver) or "esdirk" (ESDIRKTimeSolver)
+    std::string _time_integrator;
+
     unsigned int _n_timesteps;
     unsigned int _backtrack_deltat;
     double _theta;
@@ -0,0 +1,153 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_JACOBIAN_FREE_NEWTON_SOLVER_H
+#define GRINS_JACOBIAN_FREE_NEWTON_SOLVER_H
+
+// GRINS
+#include "grins/newton_solver_base.h"
+
+// libMesh
+#include "libmesh/auto_ptr.h"
+#include "libmesh/numeric_vector.h"
+#include "libmesh/shell_matrix.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  class ImplicitSystem;
+}
+
+namespace GRINS
+{
+  //! Action of the system Jacobian by directional differencing of the residual
+  /*!
+    \f$ J(u)v \approx (R(u + hv) - R(u))/h \f$, with
+    \f$ h = \epsilon (1 + \|u\|)/\|v\| \f$. Each product costs one residual
+    assembly; no global matrix is formed. The state u and R(u) are set
+    once per Newton step with set_state().
+   */
+  class JacobianFreeOperator : public libMesh::ShellMatrix<libMesh::Number>
+  {
+  public:
+
+    JacobianFreeOperator( libMesh::ImplicitSystem& system, libMesh::Real epsilon );
+    virtual ~JacobianFreeOperator();
+
+    //! Store the state, and its residual, about which the Jacobian is applied
+    void set_state( const libMesh::NumericVector<libMesh::Number>& solution,
+                    const libMesh::NumericVector<libMesh::Number>& residual );
+
+    virtual libMesh::numeric_index_type m() const;
+
+    virtual libMesh::numeric_index_type n() const;
+
+    //! dest = J*arg
+    virtual void vector_mult( libMesh::NumericVector<libMesh::Number>& dest,
+                              const libMesh::NumericVector<libMesh::Number>& arg ) const;
+
+    //! dest += J*arg
+    virtual void vector_mult_add( libMesh::NumericVector<libMesh::Number>& dest,
+                                  const libMesh::NumericVector<libMesh::Number>& arg ) const;
+
+    //! Not available without assembling the Jacobian
+    virtual void get_diagonal( libMesh::NumericVector<libMesh::Number>& dest ) const;
+
+    //! Residual assemblies done by vector_mult since construction
+    unsigned int n_residual_evaluations() const;
+
+  protected:
+
+    libMesh::ImplicitSystem& _system;
+
+    libMesh::Real _epsilon;
+
+    libMesh::AutoPtr<libMesh::NumericVector<libMesh::Number> > _solution;
+
+    libMesh::AutoPtr<libMesh::NumericVector<libMesh::Number> > _residual;
+
+    libMesh::Real _solution_norm;
+
+    mutable unsigned int _n_residual_evaluations;
+
+  };
+
+  //! Newton-Krylov solver that never assembles the full Jacobian
+  /*!
+    Used in place of libMesh::NewtonSolver when
+    linear-nonlinear-solver/jacobian_free is set. The Krylov solver sees the
+    Jacobian only through JacobianFreeOperator. Unless
+    linear-nonlinear-solver/jacobian_free_preconditioner is false, the system
+    matrix is assembled from the Physics listed in
+    linear-nonlinear-solver/preconditioner_physics (all Physics if none are
+    listed) and used only to build the preconditioner; the reuse policy
+    decides how often it is rebuilt. Without a preconditioner the system
+    matrix is released entirely.
+   */
+  class JacobianFreeNewtonSolver : public NewtonSolverBase
+  {
+  public:
+
+    JacobianFreeNewtonSolver( MultiphysicsSystem& system );
+    virtual ~JacobianFreeNewtonSolver();
+
+    virtual void print_statistics( std::ostream& out ) const;
+
+    //! Relative differencing parameter of the Jacobian-vector product
+    libMesh::Real epsilon;
+
+  protected:
+
+    //! Jacobian-vector products done by all solves
+    unsigned int _n_jacobian_products;
+
+    virtual bool uses_matrix() const;
+
+    //! Assemble the preconditioning matrix into the system matrix
+    virtual void assemble_matrix();
+
+    virtual std::pair<unsigned int, libMesh::Real>
+    solve_linear( libMesh::NumericVector<libMesh::Number>& step,
+                  libMesh::NumericVector<libMesh::Number>& rhs,
+                  libMesh::Real tolerance );
+
+    virtual std::string matrix_name() const;
+
+    //! Release the system matrix when it is not used as a preconditioner
+    virtual void init_matrix();
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+
+  inline
+  unsigned int JacobianFreeOperator::n_residual_evaluations() const
+  {
+    return _n_residual_evaluations;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_JACOBIAN_FREE_NEWTON_SOLVER_H
@@ -0,0 +1,155 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_JACOBIAN_REUSE_POLICY_H
+#define GRINS_JACOBIAN_REUSE_POLICY_H
+
+// C++
+#include <iostream>
+#include <string>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+namespace GRINS
+{
+  //! Decides when an assembled Newton matrix must be rebuilt
+  /*!
+    Newton solvers that keep their matrix (a Jacobian, or the operator a
+    preconditioner is built from) between iterations ask need_assembly()
+    before each linear solve. The matrix is rebuilt when
+      - there is none yet, or it was invalidated (e.g. after a mesh change
+        or a failed step),
+      - it has been used for max_iterations Newton iterations,
+      - it was assembled more than max_solves nonlinear solves (time steps) ago,
+      - the time step changed by more than deltat_tolerance, relative, or
+      - the last residual reduction |R_k|/|R_{k-1}| exceeded max_rate.
+    The defaults, max_iterations = max_solves = 1, reassemble every
+    iteration. As long as the matrix is unchanged the linear solver keeps its
+    factorization, so each reuse saves both an assembly and a factorization.
+   */
+  class JacobianReusePolicy
+  {
+  public:
+
+    JacobianReusePolicy();
+    ~JacobianReusePolicy();
+
+    //! Newton iterations a matrix may be used for
+    unsigned int max_iterations;
+
+    //! Nonlinear solves a matrix may span
+    unsigned int max_solves;
+
+    //! Reassemble when the residual reduction ratio is above this
+    libMesh::Real max_rate;
+
+    //! Reassemble when deltat changes by more than this fraction
+    libMesh::Real deltat_tolerance;
+
+    //! Whether any reuse is allowed at all
+    bool enabled() const;
+
+    //! Start a nonlinear solve with time step deltat (0 for steady solves)
+    void begin_solve( libMesh::Real deltat );
+
+    //! Whether the matrix must be assembled for the coming iteration
+    bool need_assembly() const;
+
+    //! Whether the current matrix was assembled before this iteration
+    bool reusing() const;
+
+    //! Record that the matrix was assembled for this iteration
+    void assembled();
+
+    //! Record that the matrix was reused for this iteration
+    void reused();
+
+    //! Record |R_k|/|R_{k-1}| after a Newton step
+    void record_rate( libMesh::Real rate );
+
+    //! Force reassembly at the next iteration
+    void invalidate();
+
+    //! Matrices assembled since construction
+    unsigned int n_assemblies() const;
+
+    //! Iterations that reused a matrix, i.e. assemblies and factorizations saved
+    unsigned int n_reuses() const;
+
+    //! Print assembly and reuse counts, labelling the matrix with name
+    void print_statistics( std::ostream& out, const std::string& name ) const;
+
+  protected:
+
+    bool _valid;
+
+    //! Set by record_rate when convergence slowed down
+    bool _slow;
+
+    unsigned int _iterations_since_assembly;
+
+    unsigned int _solves_since_assembly;
+
+    //! deltat when the matrix was assembled
+    libMesh::Real _assembly_deltat;
+
+    libMesh::Real _deltat;
+
+    unsigned int _n_assemblies;
+
+    unsigned int _n_reuses;
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+
+  inline
+  bool JacobianReusePolicy::enabled() const
+  {
+    return (max_iterations > 1 || max_solves > 1);
+  }
+
+  inline
+  bool JacobianReusePolicy::reusing() const
+  {
+    return (_valid && _iterations_since_assembly > 0);
+  }
+
+  inline
+  unsigned int JacobianReusePolicy::n_assemblies() const
+  {
+    return _n_assemblies;
+  }
+
+  inline
+  unsigned int JacobianReusePolicy::n_reuses() const
+  {
+    return _n_reuses;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_JACOBIAN_REUSE_POLICY_H
@@ -0,0 +1,67 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_LAGGED_NEWTON_SOLVER_H
+#define GRINS_LAGGED_NEWTON_SOLVER_H
+
+// GRINS
+#include "grins/newton_solver_base.h"
+
+namespace GRINS
+{
+  //! Newton solver with an assembled Jacobian that may be kept between iterations
+  /*!
+    Used in place of libMesh::NewtonSolver when the Jacobian reuse options
+    in [linear-nonlinear-solver] allow reuse. While the Jacobian is kept the
+    linear solver keeps its factorization/preconditioner too, so each
+    reused iteration costs a residual assembly and a preconditioned solve.
+    The reuse policy decides when to reassemble.
+   */
+  class LaggedNewtonSolver : public NewtonSolverBase
+  {
+  public:
+
+    LaggedNewtonSolver( MultiphysicsSystem& system );
+    virtual ~LaggedNewtonSolver();
+
+  protected:
+
+    virtual bool uses_matrix() const;
+
+    //! Assemble the Jacobian, and the residual with it
+    virtual void assemble_matrix();
+
+    virtual std::pair<unsigned int, libMesh::Real>
+    solve_linear( libMesh::NumericVector<libMesh::Number>& step,
+                  libMesh::NumericVector<libMesh::Number>& rhs,
+                  libMesh::Real tolerance );
+
+    virtual std::string matrix_name() const;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_LAGGED_NEWTON_SOLVER_H
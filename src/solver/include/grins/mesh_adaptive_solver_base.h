@@ -31,9 +31,6 @@
 // Boost
 #include <boost/scoped_ptr.hpp>
 
-// GRINS
-#include "grins/grins_solver.h"
-
 //libMesh
 #include "libmesh/libmesh.h"
 #include "libmesh/mesh_refinement.h"
@@ -48,7 +45,13 @@ namespace libMesh
 
 namespace GRINS
 {
-  class MeshAdaptiveSolverBase : public Solver
+  // Forward declarations
+  class SolverContext;
+
+  //! Mesh refinement options and flagging shared by the mesh adaptive Solvers
+  /*! Steady and unsteady adaptive Solvers derive from their Solver and from
+      this class. */
+  class MeshAdaptiveSolverBase
   {
   public:
 
@@ -80,6 +83,12 @@ namespace GRINS
     unsigned int _face_level_mismatch_limit;
     bool _enforce_mismatch_limit_prior_to_refinement;
 
+    //! Cap on the number of active elements after refinement, 0 for no cap
+    /*! When the flagged refinement would exceed it, elements are flagged
+        by the nelem_target strategy with this target instead, so the
+        refinement concentrates where the error is largest. */
+    unsigned int _max_n_elem;
+
     RefinementFlaggingType _refinement_type;
 
     boost::scoped_ptr<libMesh::MeshRefinement> _mesh_refinement;
@@ -94,6 +103,11 @@ namespace GRINS
 
     void flag_elements_for_refinement( const libMesh::ErrorVector& error );
 
+    //! Active element count after refining and coarsening the flagged elements
+    /*! Coarsening is only approximated, since parents are flagged
+        later by MeshRefinement. Must be called on all processors. */
+    libMesh::Real estimate_n_active_elem() const;
+
   private:
 
     MeshAdaptiveSolverBase();
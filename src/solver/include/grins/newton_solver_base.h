@@ -0,0 +1,133 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_NEWTON_SOLVER_BASE_H
+#define GRINS_NEWTON_SOLVER_BASE_H
+
+// C++
+#include <iostream>
+#include <string>
+#include <utility>
+
+// GRINS
+#include "grins/jacobian_reuse_policy.h"
+
+// libMesh
+#include "libmesh/auto_ptr.h"
+#include "libmesh/diff_solver.h"
+#include "libmesh/linear_solver.h"
+#include "libmesh/numeric_vector.h"
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+
+  //! Damped Newton iteration shared by the GRINS DiffSolvers
+  /*!
+    Subclasses decide what matrix, if any, is assembled and how the
+    linear system for the Newton step is solved. The matrix is rebuilt
+    only when the JacobianReusePolicy asks for it, and a step that fails
+    to reduce the residual with a reused matrix is retried with a fresh
+    one before falling back to step halving.
+
+    Tolerances and iteration limits are the usual DiffSolver ones, set by
+    Solver::set_solver_options.
+   */
+  class NewtonSolverBase : public libMesh::DiffSolver
+  {
+  public:
+
+    NewtonSolverBase( MultiphysicsSystem& system );
+    virtual ~NewtonSolverBase();
+
+    virtual void init();
+
+    virtual void reinit();
+
+    virtual unsigned int solve();
+
+    //! When to rebuild the assembled matrix
+    JacobianReusePolicy& reuse_policy();
+
+    //! Print matrix assembly and reuse counts
+    virtual void print_statistics( std::ostream& out ) const;
+
+    //! Maximum number of step halvings per Newton step
+    unsigned int max_backtracks;
+
+  protected:
+
+    MultiphysicsSystem& _multiphysics_system;
+
+    libMesh::AutoPtr<libMesh::LinearSolver<libMesh::Number> > _linear_solver;
+
+    JacobianReusePolicy _reuse_policy;
+
+    //! Whether this solver assembles a matrix at all
+    virtual bool uses_matrix() const =0;
+
+    //! Assemble the system matrix at the current solution
+    virtual void assemble_matrix() =0;
+
+    //! Solve for the Newton step; returns linear iterations and final residual
+    virtual std::pair<unsigned int, libMesh::Real>
+    solve_linear( libMesh::NumericVector<libMesh::Number>& step,
+                  libMesh::NumericVector<libMesh::Number>& rhs,
+                  libMesh::Real tolerance ) =0;
+
+    //! Name of the assembled matrix, for output
+    virtual std::string matrix_name() const =0;
+
+    //! Called by init() and reinit() once the system matrix is (re)allocated
+    virtual void init_matrix();
+
+    //! Assemble R(u) into the system rhs and return its norm
+    libMesh::Real assemble_residual();
+
+    //! Set _solve_result from the residual and, once a step is taken, step norms
+    bool test_convergence( libMesh::Real current_residual,
+                           libMesh::Real step_norm,
+                           bool step_taken );
+
+    void print_convergence( unsigned int iteration,
+                            libMesh::Real current_residual,
+                            libMesh::Real step_norm,
+                            unsigned int linear_iterations,
+                            bool reused_matrix ) const;
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+
+  inline
+  JacobianReusePolicy& NewtonSolverBase::reuse_policy()
+  {
+    return _reuse_policy;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_NEWTON_SOLVER_BASE_H
@@ -0,0 +1,98 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_PSEUDO_TRANSIENT_SOLVER_H
+#define GRINS_PSEUDO_TRANSIENT_SOLVER_H
+
+//GRINS
+#include "grins/grins_steady_solver.h"
+
+namespace GRINS
+{
+  //! Steady solve preceded by pseudo-transient continuation
+  /*!
+    For steady problems where Newton does not converge from the initial
+    guess. The steady residual is first reduced by backward Euler steps
+    in pseudo-time, reusing MultiphysicsSystem::mass_residual, with only
+    SolverOptions/PseudoTransient/newton_iterations Newton iterations
+    per step. The pseudo-timestep grows by switched evolution relaxation
+    (SER),
+
+    \f$ \Delta\tau_{k+1} = \Delta\tau_k \left( \|R(u_{k-1})\| / \|R(u_k)\| \right)^p \f$,
+
+    limited by max_growth and max_deltat, where R is the steady residual.
+    Once \f$ \|R\| \f$ is below switch_tolerance relative to its initial
+    value, or below absolute_switch_tolerance, or after max_steps pseudo-
+    timesteps, the libMesh time solver is replaced by a steady one and
+    the usual Newton solve with the linear-nonlinear-solver options
+    finishes the problem.
+
+    The Physics are stabilized for the steady problem throughout, so the
+    pseudo-time iteration converges toward the same discrete solution.
+   */
+  class PseudoTransientSolver : public SteadySolver
+  {
+  public:
+
+    PseudoTransientSolver( const GetPot& input );
+    virtual ~PseudoTransientSolver();
+
+    virtual void initialize( const GetPot& input,
+			     std::tr1::shared_ptr<libMesh::EquationSystems> equation_system,
+			     GRINS::MultiphysicsSystem* system );
+
+    virtual void solve( SolverContext& context );
+
+  protected:
+
+    //! Backward Euler in pseudo-time
+    virtual void init_time_solver(GRINS::MultiphysicsSystem* system);
+
+    //! Norm of the steady residual at the current solution
+    /*! Only valid right after advance_timestep(), when the old solution
+        equals the current one and the mass residual vanishes. */
+    libMesh::Real steady_residual( GRINS::MultiphysicsSystem& system ) const;
+
+    //! Replace the pseudo-transient time solver by a steady one
+    void switch_to_steady( GRINS::MultiphysicsSystem& system );
+
+    libMesh::Real _initial_deltat;
+    libMesh::Real _max_deltat;
+    libMesh::Real _max_growth;
+
+    //! Exponent p of the SER update
+    libMesh::Real _exponent;
+
+    //! Newton iterations per pseudo-timestep
+    unsigned int _newton_iterations;
+
+    unsigned int _max_steps;
+
+    libMesh::Real _switch_tolerance;
+    libMesh::Real _absolute_switch_tolerance;
+
+  };
+} // namespace GRINS
+#endif // GRINS_PSEUDO_TRANSIENT_SOLVER_H
@@ -58,6 +58,7 @@ namespace GRINS
   // Forward declarations
   class SimulationBuilder;
   class MultiphysicsSystem;
+  class CheckpointManager;
 
   class Simulation
   {
@@ -114,6 +115,9 @@ namespace GRINS
     void init_restart( const GetPot& input, SimulationBuilder& sim_builder,
                        const libMesh::Parallel::Communicator &comm );
 
+    //! Helper function
+    void init_checkpoint( const GetPot& input, const libMesh::Parallel::Communicator &comm );
+
     //! Helper function
     void check_for_unused_vars( const GetPot& input, bool warning_only );
 
@@ -159,6 +163,9 @@ namespace GRINS
 
     std::tr1::shared_ptr<libMesh::ErrorEstimator> _error_estimator;
 
+    //! Checkpointing and restart from checkpoints, NULL if not asked for
+    std::tr1::shared_ptr<CheckpointManager> _checkpoint;
+
     ParameterManager _adjoint_parameters;
 
     ParameterManager _forward_parameters;
@@ -40,6 +40,7 @@ namespace GRINS
 {
   // Forward declarations
   class MultiphysicsSystem;
+  class CheckpointManager;
 
   //! Simple class to hold objects passed to Solver::solve
   /*! Allows some flexibility for adding objects needed to pass to the Solver::solve
@@ -72,6 +73,9 @@ namespace GRINS
 
     std::tr1::shared_ptr<libMesh::ErrorEstimator> error_estimator;
 
+    //! Writes checkpoints during time stepping, NULL if disabled
+    std::tr1::shared_ptr<CheckpointManager> checkpoint;
+
   };
 
 } // end namespace GRINS
@@ -0,0 +1,68 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_UNSTEADY_MESH_ADAPTIVE_SOLVER_H
+#define GRINS_UNSTEADY_MESH_ADAPTIVE_SOLVER_H
+
+// GRINS
+#include "grins/grins_unsteady_solver.h"
+#include "grins/mesh_adaptive_solver_base.h"
+
+namespace GRINS
+{
+  //! Time stepping on a mesh that is refined and coarsened as the solution evolves
+  /*!
+    Every MeshAdaptivity/timesteps_per_refinement timesteps the error of
+    the current solution is estimated, elements are flagged with the
+    MeshAdaptivity/refinement_strategy, subject to MeshAdaptivity/max_n_elem,
+    and the mesh is refined and coarsened. Reinitializing the
+    EquationSystems then projects the solution together with the old
+    solution kept by the libMesh time solver, so time stepping continues
+    on the new mesh.
+
+    Adjoint based error estimators are not supported.
+   */
+  class UnsteadyMeshAdaptiveSolver : public UnsteadySolver, public MeshAdaptiveSolverBase
+  {
+  public:
+
+    UnsteadyMeshAdaptiveSolver( const GetPot& input );
+
+    virtual ~UnsteadyMeshAdaptiveSolver();
+
+    virtual void solve( SolverContext& context );
+
+  protected:
+
+    //! Adapt the mesh if this is a refinement timestep
+    virtual void end_timestep( SolverContext& context, unsigned int t_step );
+
+    unsigned int _timesteps_per_refinement;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_UNSTEADY_MESH_ADAPTIVE_SOLVER_H
@@ -0,0 +1,221 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_BOUNDARY_FACE_TREE_H
+#define GRINS_BOUNDARY_FACE_TREE_H
+
+// C++
+#include <limits>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/point.h"
+
+namespace GRINS
+{
+  //! A first order boundary face (EDGE2, TRI3 or QUAD4) stored by its vertices
+  /*! Faces are plain geometry, so they can be gathered from a distributed
+      boundary mesh without serializing it. */
+  struct BoundaryFace
+  {
+    BoundaryFace();
+
+    libMesh::ElemType type;
+
+    unsigned int n_vertices;
+
+    libMesh::Point vertex[4];
+
+    //! Dimension of the reference element: 1 for EDGE2, 2 for TRI3 and QUAD4
+    unsigned int dim() const;
+  };
+
+  //! Bounding volume hierarchy over boundary faces for nearest distance queries
+  /*!
+    Faces are split recursively at the median of their centroids along the
+    longest axis of the centroid bounds, down to leaves of at most
+    max_leaf_faces faces. Each tree node stores the axis aligned bounding box
+    of its faces.
+
+    A nearest distance query descends the nearer child first and prunes any
+    node whose box is no closer than the best face distance found so far, so
+    only a handful of faces are passed to the (expensive) exact face distance.
+    Queries are const and may be made from several threads at once.
+   */
+  class BoundaryFaceTree
+  {
+  public:
+
+    BoundaryFaceTree();
+
+    ~BoundaryFaceTree();
+
+    //! Build the hierarchy, taking over the contents of faces
+    void build( std::vector<BoundaryFace>& faces );
+
+    void clear();
+
+    bool empty() const;
+
+    unsigned int n_faces() const;
+
+    //! Distance from p to the nearest face; infinity if there are no faces
+    /*! face_distance( face, p ) must return the exact distance from p to face. */
+    template<typename FaceDistance>
+    libMesh::Real nearest_distance( const libMesh::Point& p,
+                                    const FaceDistance& face_distance ) const;
+
+    //! Largest number of faces in a leaf
+    static const unsigned int max_leaf_faces = 4;
+
+  protected:
+
+    struct TreeNode
+    {
+      libMesh::Point box_min;
+      libMesh::Point box_max;
+
+      //! Children, if this is not a leaf
+      unsigned int left;
+      unsigned int right;
+
+      //! Faces of a leaf: _faces[first] to _faces[first+n_faces-1]
+      unsigned int first;
+      unsigned int n_faces;
+    };
+
+    //! Build the subtree of faces index[begin,end) and return its node index
+    /*! Reorders index so that the faces of each leaf are contiguous. */
+    unsigned int build_node( const std::vector<BoundaryFace>& faces,
+                             const std::vector<libMesh::Point>& centroids,
+                             std::vector<unsigned int>& index,
+                             unsigned int begin, unsigned int end );
+
+    //! Squared distance from p to the box of node
+    libMesh::Real box_distance_sq( const TreeNode& node, const libMesh::Point& p ) const;
+
+    std::vector<BoundaryFace> _faces;
+
+    //! Root is _nodes[0]
+    std::vector<TreeNode> _nodes;
+  };
+
+  inline
+  unsigned int BoundaryFace::dim() const
+  {
+    return (type == libMesh::EDGE2) ? 1 : 2;
+  }
+
+  inline
+  bool BoundaryFaceTree::empty() const
+  {
+    return _faces.empty();
+  }
+
+  inline
+  unsigned int BoundaryFaceTree::n_faces() const
+  {
+    return _faces.size();
+  }
+
+  inline
+  libMesh::Real BoundaryFaceTree::box_distance_sq( const TreeNode& node, const libMesh::Point& p ) const
+  {
+    libMesh::Real d2 = 0.0;
+
+    for( unsigned int i = 0; i < LIBMESH_DIM; i++ )
+      {
+        libMesh::Real d = 0.0;
+
+        if( p(i) < node.box_min(i) )
+          d = node.box_min(i) - p(i);
+        else if( p(i) > node.box_max(i) )
+          d = p(i) - node.box_max(i);
+
+        d2 += d*d;
+      }
+
+    return d2;
+  }
+
+  template<typename FaceDistance>
+  inline
+  libMesh::Real BoundaryFaceTree::nearest_distance( const libMesh::Point& p,
+                                                    const FaceDistance& face_distance ) const
+  {
+    libMesh::Real best = std::numeric_limits<libMesh::Real>::infinity();
+
+    if( _nodes.empty() )
+      return best;
+
+    // Depth first, nearer child on top of the stack
+    std::vector<unsigned int> stack;
+    stack.reserve( 64 );
+    stack.push_back( 0 );
+
+    while( !stack.empty() )
+      {
+        const TreeNode& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        if( this->box_distance_sq( node, p ) >= best*best )
+          continue;
+
+        if( node.n_faces > 0 )
+          {
+            for( unsigned int f = node.first; f < node.first + node.n_faces; f++ )
+              {
+                const libMesh::Real d = face_distance( _faces[f], p );
+
+                if( d < best )
+                  best = d;
+              }
+
+            continue;
+          }
+
+        const libMesh::Real d_left = this->box_distance_sq( _nodes[node.left], p );
+        const libMesh::Real d_right = this->box_distance_sq( _nodes[node.right], p );
+
+        if( d_left < d_right )
+          {
+            stack.push_back( node.right );
+            stack.push_back( node.left );
+          }
+        else
+          {
+            stack.push_back( node.left );
+            stack.push_back( node.right );
+          }
+      }
+
+    return best;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_BOUNDARY_FACE_TREE_H
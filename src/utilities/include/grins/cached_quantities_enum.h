@@ -67,6 +67,9 @@ namespace GRINS
 			   OMEGA_DOT,
                            VELOCITY_PENALTY,
                            VELOCITY_PENALTY_BASE,
+                           WALL_DISTANCE,
+                           //! Number of cached quantities. Must remain last.
+                           N_CACHED_QUANTITIES
                            };
   } // namespace Cache
 } // namespace GRINS
@@ -40,6 +40,18 @@
 
 namespace GRINS
 {
+  //! Per-element storage of quantities shared between Physics classes
+  /*!
+    Storage is a flat table indexed directly by Cache::CachedQuantities.
+    Each AssemblyContext owns one CachedValues object that is reused for
+    every element and side that context visits: clear() only marks the
+    quantities as unset, so the underlying vectors keep their capacity
+    and, after the first element, no further allocation takes place.
+
+    Producers should use the prepare_* methods to obtain a correctly sized
+    vector and fill it in place. The set_* methods are retained for
+    convenience and copy into the same (reused) storage.
+   */
   class CachedValues
   {
   public:
@@ -51,20 +63,39 @@ namespace GRINS
 
     void add_quantities( const std::set<unsigned int>& cache_list );
 
+    //! Mark all quantities as unset. Memory is retained for reuse.
     void clear();
 
-    bool is_active(unsigned int quantity);
+    bool is_active(unsigned int quantity) const;
 
-    void set_values( unsigned int quantity, std::vector<libMesh::Number>& values );
+    //! Size the storage for quantity to n_qpoints and return it for filling in place.
+    std::vector<libMesh::Number>& prepare_values( unsigned int quantity,
+                                                  unsigned int n_qpoints );
+
+    //! Size the storage for quantity to n_qpoints and return it for filling in place.
+    std::vector<libMesh::Gradient>& prepare_gradient_values( unsigned int quantity,
+                                                             unsigned int n_qpoints );
+
+    //! Size the storage for quantity to n_qpoints x n_components and return it for filling in place.
+    std::vector<std::vector<libMesh::Number> >& prepare_vector_values( unsigned int quantity,
+                                                                       unsigned int n_qpoints,
+                                                                       unsigned int n_components );
+
+    //! Size the storage for quantity to n_qpoints x n_components and return it for filling in place.
+    std::vector<std::vector<libMesh::Gradient> >& prepare_vector_gradient_values( unsigned int quantity,
+                                                                                  unsigned int n_qpoints,
+                                                                                  unsigned int n_components );
+
+    void set_values( unsigned int quantity, const std::vector<libMesh::Number>& values );
 
     void set_gradient_values( unsigned int quantity,
-			      std::vector<libMesh::Gradient>& values );
+			      const std::vector<libMesh::Gradient>& values );
 
     void set_vector_values( unsigned int quantity,
-			    std::vector<std::vector<libMesh::Number> >& values );
+			    const std::vector<std::vector<libMesh::Number> >& values );
 
     void set_vector_gradient_values( unsigned int quantity,
-				     std::vector<std::vector<libMesh::Gradient> >& values );
+				     const std::vector<std::vector<libMesh::Gradient> >& values );
 
     const std::vector<libMesh::Number>& get_cached_values( unsigned int quantity ) const;
     
@@ -78,19 +109,89 @@ namespace GRINS
 
   protected:
     
-    std::set<unsigned int> _cache_list;
-
-    std::map<unsigned int,std::vector<libMesh::Number> > _cached_values;
-    std::map<unsigned int,std::vector<libMesh::Gradient> > _cached_gradient_values;
-    std::map<unsigned int,std::vector<std::vector<libMesh::Number> >  > _cached_vector_values;
-    std::map<unsigned int,std::vector<std::vector<libMesh::Gradient> >  > _cached_vector_gradient_values;
+    //! Whether each quantity has been requested through add_quantity
+    std::vector<bool> _active;
+
+    //! Whether each quantity has been set since the last clear()
+    /*! These are indexed by quantity and are tracked separately for each
+        storage type. */
+    std::vector<bool> _values_set;
+    std::vector<bool> _gradient_values_set;
+    std::vector<bool> _vector_values_set;
+    std::vector<bool> _vector_gradient_values_set;
+
+    unsigned int _n_active;
+
+    std::vector<std::vector<libMesh::Number> > _cached_values;
+    std::vector<std::vector<libMesh::Gradient> > _cached_gradient_values;
+    std::vector<std::vector<std::vector<libMesh::Number> > > _cached_vector_values;
+    std::vector<std::vector<std::vector<libMesh::Gradient> > > _cached_vector_gradient_values;
     
   };
 
   inline
   unsigned int CachedValues::size() const
   {
-    return _cache_list.size();
+    return _n_active;
+  }
+
+  inline
+  bool CachedValues::is_active( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, _active.size() );
+    return _active[quantity];
+  }
+
+  inline
+  std::vector<libMesh::Number>& CachedValues::prepare_values( unsigned int quantity,
+                                                              unsigned int n_qpoints )
+  {
+    libmesh_assert_less( quantity, _cached_values.size() );
+    _values_set[quantity] = true;
+    _cached_values[quantity].resize(n_qpoints);
+    return _cached_values[quantity];
+  }
+
+  inline
+  std::vector<libMesh::Gradient>& CachedValues::prepare_gradient_values( unsigned int quantity,
+                                                                         unsigned int n_qpoints )
+  {
+    libmesh_assert_less( quantity, _cached_gradient_values.size() );
+    _gradient_values_set[quantity] = true;
+    _cached_gradient_values[quantity].resize(n_qpoints);
+    return _cached_gradient_values[quantity];
+  }
+
+  inline
+  const std::vector<libMesh::Number>& CachedValues::get_cached_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, _cached_values.size() );
+    libmesh_assert( _values_set[quantity] );
+    return _cached_values[quantity];
+  }
+
+  inline
+  const std::vector<libMesh::Gradient>& CachedValues::get_cached_gradient_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, _cached_gradient_values.size() );
+    libmesh_assert( _gradient_values_set[quantity] );
+    return _cached_gradient_values[quantity];
+  }
+
+  inline
+  const std::vector<std::vector<libMesh::Number> >& CachedValues::get_cached_vector_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, _cached_vector_values.size() );
+    libmesh_assert( _vector_values_set[quantity] );
+    return _cached_vector_values[quantity];
+  }
+
+  inline
+  const std::vector<std::vector<libMesh::Gradient> >& CachedValues::get_cached_vector_gradient_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, _cached_vector_gradient_values.size() );
+    libmesh_assert( _vector_gradient_values_set[quantity] );
+    return _cached_vector_gradient_values[quantity];
   }
 
 } // namespace GRINS
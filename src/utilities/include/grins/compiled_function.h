@@ -0,0 +1,186 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_COMPILED_FUNCTION_H
+#define GRINS_COMPILED_FUNCTION_H
+
+// C++
+#include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/auto_ptr.h"
+#include "libmesh/function_base.h"
+#include "libmesh/dense_vector.h"
+#include "libmesh/point.h"
+#include "libmesh/fparser_ad.hh"
+
+namespace GRINS
+{
+  //! Parsed function of x, y, z and t compiled to machine code
+  /*!
+    Accepts the same expressions as libMesh::ParsedFunction, including
+    vector valued ones written as "{f0}{f1}{f2}". Each component is parsed
+    and optimized once at construction and then, if libMesh was built with
+    fparser JIT support, compiled to machine code: the parser generates
+    C++, builds it with the compiler libMesh was configured with and loads
+    the result with dlopen. If JIT support is missing, compilation fails or
+    set_compile(false) was called, the optimized bytecode interpreter is
+    used instead, see is_compiled().
+
+    clone() copies the parsed (and compiled) expressions, so functions
+    cloned by libMesh, e.g. for Dirichlet boundaries, are not compiled
+    again.
+   */
+  class CompiledFunction : public libMesh::FunctionBase<libMesh::Number>
+  {
+  public:
+
+    CompiledFunction( const std::string& expression );
+
+    virtual ~CompiledFunction();
+
+    virtual libMesh::AutoPtr<libMesh::FunctionBase<libMesh::Number> > clone() const;
+
+    //! Value of the first component at p
+    virtual libMesh::Number operator()( const libMesh::Point& p,
+                                        const libMesh::Real time = 0 );
+
+    //! Values of all components at p
+    virtual void operator()( const libMesh::Point& p,
+                             const libMesh::Real time,
+                             libMesh::DenseVector<libMesh::Number>& output );
+
+    virtual libMesh::Number component( unsigned int i,
+                                       const libMesh::Point& p,
+                                       libMesh::Real time = 0 );
+
+    //! Value of component i at each of points, e.g. all quadrature points of an element
+    void evaluate( unsigned int i,
+                   const std::vector<libMesh::Point>& points,
+                   const libMesh::Real time,
+                   std::vector<libMesh::Number>& values );
+
+    unsigned int n_components() const;
+
+    //! Whether every component is evaluated by compiled code
+    bool is_compiled() const;
+
+    const std::string& expression() const;
+
+    //! Whether CompiledFunction objects constructed from now on are compiled
+    /*! True by default. With false they use the bytecode interpreter even
+        when JIT support is available, so that it can be tested and timed. */
+    static void set_compile( bool compile );
+
+  protected:
+
+    typedef FunctionParserADBase<libMesh::Number> ParserType;
+
+    //! Evaluate _parsers[i] at the variables in _vars
+    libMesh::Number eval( unsigned int i );
+
+    //! Copy p and time into _vars
+    void set_vars( const libMesh::Point& p, const libMesh::Real time );
+
+    std::string _expression;
+
+    //! One parser per component
+    std::vector<ParserType> _parsers;
+
+    bool _compiled;
+
+    //! Current values of x, y, z and t
+    libMesh::Number _vars[4];
+
+    //! See set_compile()
+    static bool _compile_new_functions;
+
+  private:
+
+    CompiledFunction();
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+  inline
+  void CompiledFunction::set_vars( const libMesh::Point& p, const libMesh::Real time )
+  {
+    _vars[0] = p(0);
+#if LIBMESH_DIM > 1
+    _vars[1] = p(1);
+#endif
+#if LIBMESH_DIM > 2
+    _vars[2] = p(2);
+#endif
+    _vars[3] = time;
+  }
+
+  inline
+  libMesh::Number CompiledFunction::eval( unsigned int i )
+  {
+    libmesh_assert_less( i, _parsers.size() );
+    return _parsers[i].Eval(_vars);
+  }
+
+  inline
+  libMesh::Number CompiledFunction::operator()( const libMesh::Point& p,
+                                                const libMesh::Real time )
+  {
+    this->set_vars(p,time);
+    return this->eval(0);
+  }
+
+  inline
+  libMesh::Number CompiledFunction::component( unsigned int i,
+                                               const libMesh::Point& p,
+                                               libMesh::Real time )
+  {
+    this->set_vars(p,time);
+    return this->eval(i);
+  }
+
+  inline
+  unsigned int CompiledFunction::n_components() const
+  {
+    return _parsers.size();
+  }
+
+  inline
+  bool CompiledFunction::is_compiled() const
+  {
+    return _compiled;
+  }
+
+  inline
+  const std::string& CompiledFunction::expression() const
+  {
+    return _expression;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_COMPILED_FUNCTION_H
@@ -37,12 +37,16 @@
 #include "libmesh/fe_base.h"
 #include "libmesh/system.h"
 
+// GRINS
+#include "grins/boundary_face_tree.h"
+
 // Forward Declarations
 namespace libMesh {
   class EquationSystems;
   class BoundaryMesh;
   class Node;
   class Elem;
+  class FEMSystem;
 }
 
 
@@ -70,13 +74,16 @@ namespace GRINS {
     virtual void initialize ();
 
     /**
-     * Compute distance from input node to boundary_mesh
+     * Compute distance from input node to boundary_mesh.
+     * Only valid once compute() has built the boundary face tree.
+     * Thread safe.
      */
-    libMesh::Real node_to_boundary (const libMesh::Node* node);
+    libMesh::Real node_to_boundary (const libMesh::Node* node) const;
 
     /**
      * Initialize "distance_function" equation system by computing
-     * distance from each mesh node to the nearest point in boundary_mesh
+     * distance from each mesh node to the nearest point in boundary_mesh.
+     * Local nodes are processed in parallel by libMesh threads.
      */
     void compute ();
 
@@ -85,10 +92,37 @@ namespace GRINS {
      */
     libMesh::AutoPtr< libMesh::DenseVector<libMesh::Real> > interpolate (const libMesh::Elem* elem, const std::vector<libMesh::Point>& qts) const;
 
+    /**
+     * Interpolate the distance function to the element quadrature points
+     * that system uses in assembly, for each active local element, and
+     * store the values for qp_distance(). Must be called again once the
+     * mesh has been refined or redistributed, see qp_table_current().
+     */
+    void tabulate (libMesh::FEMSystem& system);
+
+    /**
+     * Whether the table built by tabulate() still matches the active local
+     * elements of the mesh
+     */
+    bool qp_table_current () const;
+
+    /**
+     * Distances tabulated at the n_qpoints quadrature points of elem, or
+     * NULL if elem is not in the table, in which case interpolate() must
+     * be used. Thread safe.
+     */
+    const libMesh::Real* qp_distance (const libMesh::Elem& elem, unsigned int n_qpoints) const;
+
 
 
   private:
 
+    /**
+     * Gather the faces of the boundary mesh, from every processor if it is
+     * distributed, and build _face_tree from them
+     */
+    void build_face_tree ();
+
     /**
      * Pointer to EquationSystems object
      */
@@ -109,8 +143,43 @@ namespace GRINS {
      */
     libMesh::AutoPtr<libMesh::FEBase> _dist_fe;
 
+    /**
+     * Bounding volume hierarchy over the boundary faces, so that only the
+     * few faces near a node are projected onto
+     */
+    BoundaryFaceTree _face_tree;
+
+    /**
+     * Element tabulated for each element id, NULL if none
+     */
+    std::vector<const libMesh::Elem*> _qp_elem;
+
+    /**
+     * Offset into _qp_distance of the values of each element id. The values
+     * of element id are in [_qp_offset[id], _qp_offset[id+1]).
+     */
+    std::vector<unsigned int> _qp_offset;
+
+    /**
+     * Distances at the quadrature points of all tabulated elements
+     */
+    std::vector<libMesh::Real> _qp_distance;
+
+    /**
+     * Number of tabulated elements
+     */
+    unsigned int _qp_n_elem;
+
   };
 
+  /**
+   * Distance from point to a first order (EDGE2, TRI3 or QUAD4) boundary
+   * face. The point is projected onto the face by Newton iteration; if the
+   * projection lies outside the face, the distance to the nearest edge is
+   * returned instead.
+   */
+  libMesh::Real distance_to_face (const BoundaryFace& face, const libMesh::Point& point);
+
   /**
    * This class provides the functionality to compute finite difference
    * Jacobians required when computing the distance function
@@ -184,84 +253,101 @@ namespace GRINS {
    * point and the boundary point wrt the boundary parameterization.
    * When this residual is zero, the distance is minimized, and we have
    * found the point we're looking for.
+   *
+   * Supports first order EDGE2, TRI3 and QUAD4 faces, using the libMesh
+   * reference elements for the parameterization.
    */
   class ComputeDistanceResidual
   {
   public:
 
     // ctor
-    ComputeDistanceResidual(const libMesh::Elem* belem, const libMesh::Point* point) :
-      _belem(*belem),
-      _dim(_belem.dim()+1),
-      _p(*point),
-      _fe (libMesh::FEBase::build(_belem.dim(), libMesh::FEType(libMesh::FIRST, libMesh::LAGRANGE))),
-      fe  (_fe.get())
+    ComputeDistanceResidual(const BoundaryFace& face, const libMesh::Point& point) :
+      _face(face),
+      _dim(face.dim()),
+      _p(point)
     {
-      // only supporting QUAD4 this way for now
-      libmesh_assert(_belem.type()==libMesh::QUAD4);
+      libmesh_assert( (_face.type==libMesh::EDGE2) ||
+                      (_face.type==libMesh::TRI3)  ||
+                      (_face.type==libMesh::QUAD4) );
     }
 
     // dtor
     ~ComputeDistanceResidual(){}
 
-    // Calculate the residual
-    void operator()(const libMesh::DenseVector<libMesh::Real> &U,
-                    libMesh::DenseVector<libMesh::Real> &F)
+    /**
+     * Location x on the face at reference coordinates U, and its
+     * derivatives dxdU[j] with respect to U(j)
+     */
+    void map(const libMesh::DenseVector<libMesh::Real> &U,
+             libMesh::Point &x,
+             libMesh::Point dxdU[2]) const
     {
+      libmesh_assert(U.size()==_dim);
 
-      libmesh_assert(U.size()==_dim-1);
-      libmesh_assert(F.size()==_dim-1);
-
-      libMesh::DenseVector<libMesh::Real> xx(_dim);
-      xx.zero();
-
-      libMesh::DenseMatrix<libMesh::Real> xx_U(_dim, _dim-1);
-      xx_U.zero();
+      // Shape functions and their derivatives at U
+      libMesh::Real phi[4], dphi[4][2];
 
-      std::vector<libMesh::Point> xi(1);
-
-      xi[0](0) = U(0);
-      xi[0](1) = U(1);
-
-      // grab basis functions (evaluated at qpts)
-      const std::vector<std::vector<libMesh::Real> > &basis = fe->get_phi();
-      const std::vector<std::vector<libMesh::RealGradient> > &dbasis = fe->get_dphi();
+      if (_face.type==libMesh::EDGE2)
+        {
+          phi[0] = 0.5*(1.0 - U(0));  dphi[0][0] = -0.5;
+          phi[1] = 0.5*(1.0 + U(0));  dphi[1][0] =  0.5;
+        }
+      else if (_face.type==libMesh::TRI3)
+        {
+          phi[0] = 1.0 - U(0) - U(1);  dphi[0][0] = -1.0;  dphi[0][1] = -1.0;
+          phi[1] = U(0);               dphi[1][0] =  1.0;  dphi[1][1] =  0.0;
+          phi[2] = U(1);               dphi[2][0] =  0.0;  dphi[2][1] =  1.0;
+        }
+      else
+        {
+          // Vertices of the reference QUAD4
+          const libMesh::Real xi_v[4] = {-1.0, 1.0, 1.0, -1.0};
+          const libMesh::Real et_v[4] = {-1.0, -1.0, 1.0, 1.0};
+
+          for (unsigned int inode=0; inode<4; ++inode)
+            {
+              phi[inode]     = 0.25*(1.0 + xi_v[inode]*U(0))*(1.0 + et_v[inode]*U(1));
+              dphi[inode][0] = 0.25*xi_v[inode]*(1.0 + et_v[inode]*U(1));
+              dphi[inode][1] = 0.25*(1.0 + xi_v[inode]*U(0))*et_v[inode];
+            }
+        }
 
-      // reinitialize finite element data at xi
-      fe->reinit(&_belem, &xi);
+      x.zero();
+      for (unsigned int jdim=0; jdim<_dim; ++jdim)
+        dxdU[jdim].zero();
 
       // interpolate location and derivatives
-      for (unsigned int inode=0; inode<_belem.n_nodes(); ++inode)
-        for (unsigned int idim=0; idim<_dim; ++idim)
-          {
-            xx(idim) += _belem.point(inode)(idim) * basis[inode][0];
+      for (unsigned int inode=0; inode<_face.n_vertices; ++inode)
+        {
+          x.add_scaled(_face.vertex[inode], phi[inode]);
 
-            for (unsigned int jdim=0; jdim<_dim-1; ++jdim)
-              xx_U(idim, jdim) += _belem.point(inode)(idim) * dbasis[inode][0](jdim);
-          }
+          for (unsigned int jdim=0; jdim<_dim; ++jdim)
+            dxdU[jdim].add_scaled(_face.vertex[inode], dphi[inode][jdim]);
+        }
+    }
 
+    // Calculate the residual
+    void operator()(const libMesh::DenseVector<libMesh::Real> &U,
+                    libMesh::DenseVector<libMesh::Real> &F)
+    {
+      libmesh_assert(F.size()==_dim);
 
-      // form the residual
-      F.zero();
-      for (unsigned int ires=0; ires<_dim-1; ++ires)
-        for (unsigned int idim=0; idim<_dim; ++idim)
-          F(ires) += ( xx(idim) - _p(idim) ) * xx_U(idim, ires);
+      libMesh::Point xx, xx_U[2];
 
+      this->map(U, xx, xx_U);
 
+      // form the residual
+      for (unsigned int ires=0; ires<_dim; ++ires)
+        F(ires) = (xx - _p) * xx_U[ires];
     }
 
   private:
 
-    // Reference to boundary element
-    const libMesh::Elem& _belem;
+    // Reference to boundary face
+    const BoundaryFace& _face;
     const unsigned int _dim;
     const libMesh::Point& _p;
-
-    libMesh::AutoPtr<libMesh::FEBase> _fe;
-    libMesh::FEBase *fe;
-
-    // work vectors
-    libMesh::DenseVector<libMesh::Real>    Up, Fp, Um, Fm;
   };
 
 } // end namespace GRINS
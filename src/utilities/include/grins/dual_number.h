@@ -0,0 +1,376 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef GRINS_DUAL_NUMBER_H
+#define GRINS_DUAL_NUMBER_H
+
+// C++
+#include <cmath>
+
+// libMesh
+#include "libmesh/libmesh.h"
+
+namespace GRINS
+{
+  //! Forward-mode automatic differentiation scalar
+  /*! Carries a value together with its derivatives with respect to N
+      independent variables, typically the local degrees of freedom of an
+      element. The i-th independent variable is seeded with DualNumber(value,i).
+      A residual kernel templated on its scalar type then yields, from one
+      evaluation with this type, the residual and its exact derivatives.
+      Comparisons only look at the value, so a kernel takes the same branches
+      as it does with libMesh::Real. N is fixed at compile time so that no
+      memory is allocated; callers pick the smallest N covering their dofs. */
+  template<unsigned int N>
+  class DualNumber
+  {
+  public:
+
+    //! Zero value and derivatives
+    DualNumber();
+
+    //! A constant: zero derivatives. Implicit so constants mix freely with duals.
+    DualNumber( libMesh::Real value );
+
+    //! The i-th independent variable
+    DualNumber( libMesh::Real value, unsigned int i );
+
+    libMesh::Real value() const;
+
+    libMesh::Real derivative( unsigned int i ) const;
+
+    static unsigned int size();
+
+    DualNumber<N>& operator+=( const DualNumber<N>& b );
+    DualNumber<N>& operator-=( const DualNumber<N>& b );
+    DualNumber<N>& operator*=( const DualNumber<N>& b );
+    DualNumber<N>& operator/=( const DualNumber<N>& b );
+
+    DualNumber<N>& operator+=( libMesh::Real b );
+    DualNumber<N>& operator-=( libMesh::Real b );
+    DualNumber<N>& operator*=( libMesh::Real b );
+    DualNumber<N>& operator/=( libMesh::Real b );
+
+    //! Chain rule for f(this) given f and f'(this)
+    DualNumber<N> compose( libMesh::Real f, libMesh::Real df ) const;
+
+  private:
+
+    libMesh::Real _value;
+
+    libMesh::Real _derivs[N];
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+
+  template<unsigned int N>
+  inline
+  DualNumber<N>::DualNumber()
+    : _value(0.0)
+  {
+    for( unsigned int i = 0; i < N; i++ )
+      _derivs[i] = 0.0;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N>::DualNumber( libMesh::Real value )
+    : _value(value)
+  {
+    for( unsigned int i = 0; i < N; i++ )
+      _derivs[i] = 0.0;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N>::DualNumber( libMesh::Real value, unsigned int i )
+    : _value(value)
+  {
+    libmesh_assert_less( i, N );
+
+    for( unsigned int j = 0; j < N; j++ )
+      _derivs[j] = 0.0;
+
+    _derivs[i] = 1.0;
+  }
+
+  template<unsigned int N>
+  inline
+  libMesh::Real DualNumber<N>::value() const
+  {
+    return _value;
+  }
+
+  template<unsigned int N>
+  inline
+  libMesh::Real DualNumber<N>::derivative( unsigned int i ) const
+  {
+    libmesh_assert_less( i, N );
+    return _derivs[i];
+  }
+
+  template<unsigned int N>
+  inline
+  unsigned int DualNumber<N>::size()
+  {
+    return N;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N>& DualNumber<N>::operator+=( const DualNumber<N>& b )
+  {
+    _value += b._value;
+    for( unsigned int i = 0; i < N; i++ )
+      _derivs[i] += b._derivs[i];
+
+    return *this;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N>& DualNumber<N>::operator-=( const DualNumber<N>& b )
+  {
+    _value -= b._value;
+    for( unsigned int i = 0; i < N; i++ )
+      _derivs[i] -= b._derivs[i];
+
+    return *this;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N>& DualNumber<N>::operator*=( const DualNumber<N>& b )
+  {
+    for( unsigned int i = 0; i < N; i++ )
+      _derivs[i] = _derivs[i]*b._value + _value*b._derivs[i];
+
+    _value *= b._value;
+
+    return *this;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N>& DualNumber<N>::operator/=( const DualNumber<N>& b )
+  {
+    const libMesh::Real b_inv = 1.0/b._value;
+    const libMesh::Real quotient = _value/b._value;
+
+    for( unsigned int i = 0; i < N; i++ )
+      _derivs[i] = (_derivs[i] - quotient*b._derivs[i])*b_inv;
+
+    _value = quotient;
+
+    return *this;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N>& DualNumber<N>::operator+=( libMesh::Real b )
+  {
+    _value += b;
+    return *this;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N>& DualNumber<N>::operator-=( libMesh::Real b )
+  {
+    _value -= b;
+    return *this;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N>& DualNumber<N>::operator*=( libMesh::Real b )
+  {
+    _value *= b;
+    for( unsigned int i = 0; i < N; i++ )
+      _derivs[i] *= b;
+
+    return *this;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N>& DualNumber<N>::operator/=( libMesh::Real b )
+  {
+    _value /= b;
+    for( unsigned int i = 0; i < N; i++ )
+      _derivs[i] /= b;
+
+    return *this;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N> DualNumber<N>::compose( libMesh::Real f, libMesh::Real df ) const
+  {
+    DualNumber<N> result(f);
+    for( unsigned int i = 0; i < N; i++ )
+      result._derivs[i] = df*_derivs[i];
+
+    return result;
+  }
+
+  // Arithmetic
+
+  template<unsigned int N>
+  inline
+  DualNumber<N> operator+( const DualNumber<N>& a )
+  {
+    return a;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N> operator-( const DualNumber<N>& a )
+  {
+    DualNumber<N> result(a);
+    result *= -1.0;
+    return result;
+  }
+
+#define GRINS_DUAL_NUMBER_BINARY_OP(op,opeq)                            \
+  template<unsigned int N>                                              \
+  inline                                                                \
+  DualNumber<N> operator op( const DualNumber<N>& a, const DualNumber<N>& b ) \
+  {                                                                     \
+    DualNumber<N> result(a);                                            \
+    result opeq b;                                                      \
+    return result;                                                      \
+  }                                                                     \
+                                                                        \
+  template<unsigned int N>                                              \
+  inline                                                                \
+  DualNumber<N> operator op( const DualNumber<N>& a, libMesh::Real b )  \
+  {                                                                     \
+    DualNumber<N> result(a);                                            \
+    result opeq b;                                                      \
+    return result;                                                      \
+  }                                                                     \
+                                                                        \
+  template<unsigned int N>                                              \
+  inline                                                                \
+  DualNumber<N> operator op( libMesh::Real a, const DualNumber<N>& b )  \
+  {                                                                     \
+    DualNumber<N> result(a);                                            \
+    result opeq b;                                                      \
+    return result;                                                      \
+  }
+
+  GRINS_DUAL_NUMBER_BINARY_OP(+,+=)
+  GRINS_DUAL_NUMBER_BINARY_OP(-,-=)
+  GRINS_DUAL_NUMBER_BINARY_OP(*,*=)
+  GRINS_DUAL_NUMBER_BINARY_OP(/,/=)
+
+#undef GRINS_DUAL_NUMBER_BINARY_OP
+
+  // Comparisons act on the value only
+
+#define GRINS_DUAL_NUMBER_COMPARISON(op)                                \
+  template<unsigned int N>                                              \
+  inline                                                                \
+  bool operator op( const DualNumber<N>& a, const DualNumber<N>& b )    \
+  {                                                                     \
+    return a.value() op b.value();                                      \
+  }                                                                     \
+                                                                        \
+  template<unsigned int N>                                              \
+  inline                                                                \
+  bool operator op( const DualNumber<N>& a, libMesh::Real b )           \
+  {                                                                     \
+    return a.value() op b;                                              \
+  }                                                                     \
+                                                                        \
+  template<unsigned int N>                                              \
+  inline                                                                \
+  bool operator op( libMesh::Real a, const DualNumber<N>& b )           \
+  {                                                                     \
+    return a op b.value();                                              \
+  }
+
+  GRINS_DUAL_NUMBER_COMPARISON(<)
+  GRINS_DUAL_NUMBER_COMPARISON(<=)
+  GRINS_DUAL_NUMBER_COMPARISON(>)
+  GRINS_DUAL_NUMBER_COMPARISON(>=)
+  GRINS_DUAL_NUMBER_COMPARISON(==)
+  GRINS_DUAL_NUMBER_COMPARISON(!=)
+
+#undef GRINS_DUAL_NUMBER_COMPARISON
+
+  // Elementary functions. Kernels should bring the std:: versions into
+  // scope with using-declarations and call these unqualified, so that
+  // the same source works for libMesh::Real and DualNumber.
+
+  template<unsigned int N>
+  inline
+  DualNumber<N> exp( const DualNumber<N>& a )
+  {
+    const libMesh::Real f = std::exp(a.value());
+    return a.compose( f, f );
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N> log( const DualNumber<N>& a )
+  {
+    return a.compose( std::log(a.value()), 1.0/a.value() );
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N> sqrt( const DualNumber<N>& a )
+  {
+    const libMesh::Real f = std::sqrt(a.value());
+    return a.compose( f, 0.5/f );
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N> pow( const DualNumber<N>& a, libMesh::Real b )
+  {
+    const libMesh::Real f = std::pow(a.value(), b);
+    return a.compose( f, b*std::pow(a.value(), b-1.0) );
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N> abs( const DualNumber<N>& a )
+  {
+    return (a.value() < 0.0) ? -a : a;
+  }
+
+  template<unsigned int N>
+  inline
+  DualNumber<N> fabs( const DualNumber<N>& a )
+  {
+    return abs(a);
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_DUAL_NUMBER_H
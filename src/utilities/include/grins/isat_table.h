@@ -0,0 +1,219 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2015 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+
+#ifndef GRINS_ISAT_TABLE_H
+#define GRINS_ISAT_TABLE_H
+
+// C++
+#include <iostream>
+#include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/threads.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  //! In situ adaptive tabulation (ISAT) of a smooth mapping f: R^n -> R^m
+  /*!
+    Following Pope (1997), each record stores a query point x0, f(x0), the
+    mapping gradient A = df/dx at x0, and an ellipsoid of accuracy (EOA)
+    { x : (x-x0)^T M (x-x0) <= 1 } inside which the linear approximation
+    f(x0) + A (x-x0) is trusted. Records are the leaves of a binary tree whose
+    internal nodes are cutting planes v^T x = a.
+
+    A query descends the tree to a single leaf. If x is in that record's EOA
+    the linear approximation is returned (a retrieve). Otherwise the caller
+    evaluates f directly and offers it to grow(): if the record's linear
+    approximation is within tolerance at x, the EOA is grown to the minimum
+    volume ellipsoid containing it and x (a grow). Failing that, the caller
+    computes the gradient and calls add(), which splits the leaf.
+
+    Tolerance is ||f_linear - f|| <= tolerance*||f|| + absolute_tolerance.
+    The initial EOA of a record is where the linearized change in f is within
+    that tolerance, bounded by a ball of radius max_radius, so the inputs
+    should be scaled to comparable magnitudes by the caller.
+
+    All operations take a mutex, so a table can be shared by all threads.
+    The expensive direct evaluations happen outside of the table and so are
+    not serialized.
+   */
+  class ISATTable
+  {
+  public:
+
+    //! Parameters controlling the accuracy and size of an ISATTable
+    struct Options
+    {
+      Options();
+
+      //! Parse options from input, e.g. section = "Physics/Chemistry/ISAT"
+      void read_input_options( const GetPot& input, const std::string& section );
+
+      libMesh::Real tolerance;
+
+      libMesh::Real absolute_tolerance;
+
+      //! Records are no longer added once this many are stored
+      unsigned int max_records;
+
+      //! Largest semi-axis of an initial EOA
+      libMesh::Real max_radius;
+    };
+
+    ISATTable( unsigned int n_inputs, unsigned int n_outputs, const Options& options );
+
+    ~ISATTable();
+
+    //! Linear approximation of f at x, if x lies in the EOA of the record it maps to
+    /*! Returns false, and leaves f untouched, on a miss. */
+    bool retrieve( const std::vector<libMesh::Real>& x, std::vector<libMesh::Real>& f );
+
+    //! As above, also copying the record gradient, i.e. the derivative of f at x, into A
+    /*! A is n_outputs x n_inputs, row-major, and is left untouched on a miss. */
+    bool retrieve( const std::vector<libMesh::Real>& x, std::vector<libMesh::Real>& f,
+                   std::vector<libMesh::Real>& A );
+
+    //! Offer the directly evaluated f at a missed x to grow an existing EOA
+    /*! Returns false if the nearest record is not accurate enough at x, in
+        which case a new record should be added unless the table is full(). */
+    bool grow( const std::vector<libMesh::Real>& x, const std::vector<libMesh::Real>& f );
+
+    //! Add a record with value f and gradient A at x
+    /*! A is n_outputs x n_inputs, row-major. Does nothing if the table is full. */
+    void add( const std::vector<libMesh::Real>& x, const std::vector<libMesh::Real>& f,
+              const std::vector<libMesh::Real>& A );
+
+    //! Whether max_records has been reached
+    bool full() const;
+
+    unsigned int n_records() const;
+
+    //! Numbers of queries, retrieves, grows, adds, misses not added because the table was full, and records
+    /*! Counts may be summed across processors before being printed. */
+    void statistics( std::vector<unsigned long>& counts ) const;
+
+    //! Print counts given by statistics()
+    static void print_statistics( const std::vector<unsigned long>& counts, std::ostream& out );
+
+  protected:
+
+    struct Record
+    {
+      std::vector<libMesh::Real> x0;
+
+      std::vector<libMesh::Real> f0;
+
+      //! Mapping gradient, n_outputs x n_inputs
+      std::vector<libMesh::Real> A;
+
+      //! EOA matrix, n_inputs x n_inputs
+      std::vector<libMesh::Real> M;
+    };
+
+    struct Node
+    {
+      //! Index into _records for leaves, -1 for internal nodes
+      int record;
+
+      unsigned int left;
+
+      unsigned int right;
+
+      //! Cutting plane v^T x = a; x goes left if v^T x < a
+      std::vector<libMesh::Real> v;
+
+      libMesh::Real a;
+    };
+
+    //! retrieve(), copying the record gradient into A unless it is NULL
+    bool retrieve_record( const std::vector<libMesh::Real>& x, std::vector<libMesh::Real>& f,
+                          std::vector<libMesh::Real>* A );
+
+    //! Index of the leaf node x maps to. There must be at least one record.
+    unsigned int find_leaf( const std::vector<libMesh::Real>& x ) const;
+
+    //! (x - x0)^T M (x - x0) for record r, with x - x0 left in _dx
+    libMesh::Real eoa_norm( const Record& r, const std::vector<libMesh::Real>& x );
+
+    //! f0 + A (x - x0) for record r, using _dx from eoa_norm()
+    void linear_approximation( const Record& r, std::vector<libMesh::Real>& f ) const;
+
+    unsigned int _n_inputs;
+
+    unsigned int _n_outputs;
+
+    Options _options;
+
+    std::vector<Record> _records;
+
+    std::vector<Node> _nodes;
+
+    unsigned long _n_queries;
+
+    unsigned long _n_retrieves;
+
+    unsigned long _n_grows;
+
+    unsigned long _n_adds;
+
+    unsigned long _n_unstored;
+
+    //! Work arrays, only used while holding _mutex
+    std::vector<libMesh::Real> _dx, _Mdx, _f_linear;
+
+    mutable libMesh::Threads::spin_mutex _mutex;
+
+  private:
+
+    ISATTable();
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+  inline
+  bool ISATTable::full() const
+  {
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+
+    return _records.size() >= _options.max_records;
+  }
+
+  inline
+  unsigned int ISATTable::n_records() const
+  {
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+
+    return _records.size();
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_ISAT_TABLE_H